@@ -43,6 +43,7 @@ struct rgb_s
 
 static struct rgb_s pixels[1024];
 static int npixels = 0;
+static int expand = 0;
 
 /****************************************************************************
  * Private Functions
@@ -65,6 +66,113 @@ static unsigned char getmono(unsigned char r, unsigned char g, unsigned char b)
   return mono;
 }
 
+static unsigned int brighten(unsigned int color)
+{
+  return (3*color + 0xff) >> 2;
+}
+
+static unsigned int torgb24(const struct rgb_s *pixel, int bright)
+{
+  unsigned int r = pixel->r; /* 8->8 bits */
+  unsigned int g = pixel->g; /* 8->8 bits */
+  unsigned int b = pixel->b; /* 8->8 bits */
+
+  if (bright)
+    {
+      r = brighten(r);
+      g = brighten(g);
+      b = brighten(b);
+    }
+
+  return r << 16 | g << 8 | b;
+}
+
+static unsigned int torgb16(const struct rgb_s *pixel, int bright)
+{
+  unsigned int r = pixel->r;
+  unsigned int g = pixel->g;
+  unsigned int b = pixel->b;
+
+  if (bright)
+    {
+      r = brighten(r);
+      g = brighten(g);
+      b = brighten(b);
+    }
+
+  r >>= 3;   /* 8->5 bits */
+  g >>= 2;   /* 8->6 bits */
+  b >>= 3;   /* 8->5 bits */
+
+  if (r > 0x1f)
+    {
+      r = 0x1f;
+    }
+
+  if (g > 0x3f)
+    {
+      g = 0x3f;
+    }
+
+  if (b > 0x1f)
+    {
+      b = 0x1f;
+    }
+
+  return r << 11 | g << 5 | b;
+}
+
+static unsigned int torgb8(const struct rgb_s *pixel, int bright)
+{
+  unsigned int r = pixel->r;
+  unsigned int g = pixel->g;
+  unsigned int b = pixel->b;
+
+  if (bright)
+    {
+      r = brighten(r);
+      g = brighten(g);
+      b = brighten(b);
+    }
+
+  r = (r + 2) >> 5; /* 8->3 bits */
+  g = (g + 2) >> 5; /* 8->3 bits */
+  b = (b + 4) >> 6; /* 8->2 bits */
+
+  if (r > 0x07)
+    {
+      r = 0x07;
+    }
+
+  if (g > 0x07)
+    {
+      g = 0x07;
+    }
+
+  if (b > 0x03)
+    {
+      b = 0x03;
+    }
+
+  return r << 5 | g << 2 | b;
+}
+
+static unsigned int tomono8(const struct rgb_s *pixel, int bright)
+{
+  unsigned int r = pixel->r;
+  unsigned int g = pixel->g;
+  unsigned int b = pixel->b;
+
+  if (bright)
+    {
+      r = brighten(r);
+      g = brighten(g);
+      b = brighten(b);
+    }
+
+  return getmono(r, g, b);
+}
+
 static int findpixel(unsigned char r, unsigned char g, unsigned char b)
 {
   int i;
@@ -111,6 +219,59 @@ static void addpixel(unsigned char r, unsigned char g, unsigned char b)
   npixels++;
 }
 
+/* Print the complete image expanded into one display format.  Each pixel
+ * gets the value that the LUT would provide at run time.
+ */
+
+static void printexpanded(const char *type, const char *name, int bright,
+                          unsigned int (*convert)(const struct rgb_s *, int),
+                          const char *fmt, int perline)
+{
+  const unsigned char *ptr;
+  unsigned char r;
+  unsigned char g;
+  unsigned char b;
+  int i;
+  int j;
+
+  printf("static const %s g_xxx%sPixels[BITMAP_NROWS * BITMAP_NCOLUMNS] =\n",
+         type, name);
+  printf("{\n");
+
+  ptr = gimp_image.pixel_data;
+
+  for (i = 0; i < gimp_image.height; i++)
+    {
+      for (j = 0; j < gimp_image.width; j++)
+        {
+          r = *ptr++;
+          g = *ptr++;
+          b = *ptr++;
+
+          if (j % perline == 0)
+            {
+              printf(" ");
+            }
+
+          printf(" ");
+          printf(fmt, convert(&pixels[findpixel(r, g, b)], bright));
+          printf(",");
+
+          if (j % perline == perline - 1 || j == gimp_image.width - 1)
+            {
+              if (j < perline)
+                {
+                  printf("  /* Row %d */", i);
+                }
+
+              printf("\n");
+            }
+        }
+    }
+
+  printf("};\n\n");
+}
+
 /****************************************************************************
  * Public Functions
  ****************************************************************************/
@@ -130,23 +291,38 @@ int main(int argc, char **argv, char **envp)
   int i;
   int j;
 
+  /* -x: Also generate the image pre-expanded into the display format */
+
+  for (i = 1; i < argc; i++)
+    {
+      if (argv[i][0] == '-' && argv[i][1] == 'x' && argv[i][2] == '\0')
+        {
+          expand = 1;
+        }
+      else
+        {
+          fprintf(stderr, "Unrecognized argument: %s\n", argv[i]);
+          exit(1);
+        }
+    }
+
   printf("/********************************************************************************************\n");
   printf(" * apps/graphics/nxglyphs/src/glyph_xxxxxx.cxx\n");
   printf(" *\n");
-  printf(" * Licensed to the Apache Software Foundation (ASF) under one or more");
-  printf(" * contributor license agreements.  See the NOTICE file distributed with");
-  printf(" * this work for additional information regarding copyright ownership.  The");
-  printf(" * ASF licenses this file to you under the Apache License, Version 2.0 (the");
-  printf(" * "License"); you may not use this file except in compliance with the");
-  printf(" * License.  You may obtain a copy of the License at");
-  printf(" *");
-  printf(" *   http://www.apache.org/licenses/LICENSE-2.0");
-  printf(" *");
-  printf(" * Unless required by applicable law or agreed to in writing, software");
-  printf(" * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT");
-  printf(" * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the");
-  printf(" * License for the specific language governing permissions and limitations");
-  printf(" * under the License.");
+  printf(" * Licensed to the Apache Software Foundation (ASF) under one or more\n");
+  printf(" * contributor license agreements.  See the NOTICE file distributed with\n");
+  printf(" * this work for additional information regarding copyright ownership.  The\n");
+  printf(" * ASF licenses this file to you under the Apache License, Version 2.0 (the\n");
+  printf(" * \"License\"); you may not use this file except in compliance with the\n");
+  printf(" * License.  You may obtain a copy of the License at\n");
+  printf(" *\n");
+  printf(" *   http://www.apache.org/licenses/LICENSE-2.0\n");
+  printf(" *\n");
+  printf(" * Unless required by applicable law or agreed to in writing, software\n");
+  printf(" * distributed under the License is distributed on an \"AS IS\" BASIS, WITHOUT\n");
+  printf(" * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the\n");
+  printf(" * License for the specific language governing permissions and limitations\n");
+  printf(" * under the License.\n");
   printf(" *\n");
   printf(" ********************************************************************************************/\n\n");
 
@@ -341,7 +517,7 @@ int main(int argc, char **argv, char **envp)
       printf("  /* Codes %d-%d */\n", i, i+j-1);
     }
 
-  printf("}\n\n");
+  printf("};\n\n");
   printf("static const uint8_t g_xxxBrightLut[BITMAP_NLUTCODES] =\n");
   printf("{\n");
 
@@ -526,6 +702,40 @@ int main(int argc, char **argv, char **envp)
     }
 
   printf("};\n\n");
+
+  if (expand)
+    {
+      printf("#ifdef CONFIG_NXWIDGETS_RLEEXPANDED\n");
+      printf("// The complete image, already expanded into the display format using\n");
+      printf("// each LUT.  CRlePaletteBitmap copies runs from these instead of decoding\n");
+      printf("// the RLE data.\n\n");
+
+      printf("#if CONFIG_NXWIDGETS_BPP == 24 ||  CONFIG_NXWIDGETS_BPP == 32\n");
+      printf("// RGB24 (8-8-8) Colors\n\n");
+      printexpanded("uint32_t", "Normal", 0, torgb24, "0x%06x", 8);
+      printexpanded("uint32_t", "Bright", 1, torgb24, "0x%06x", 8);
+
+      printf("#elif CONFIG_NXWIDGETS_BPP == 16\n");
+      printf("// RGB16 (565) Colors\n\n");
+      printexpanded("uint16_t", "Normal", 0, torgb16, "0x%04x", 10);
+      printexpanded("uint16_t", "Bright", 1, torgb16, "0x%04x", 10);
+
+      printf("#elif CONFIG_NXWIDGETS_BPP == 8\n");
+      printf("#  ifdef CONFIG_NXWIDGETS_GREYSCALE\n");
+      printf("// 8-bit Greyscale\n\n");
+      printexpanded("uint8_t", "Normal", 0, tomono8, "0x%02x", 16);
+      printexpanded("uint8_t", "Bright", 1, tomono8, "0x%02x", 16);
+
+      printf("#  else /* CONFIG_NXWIDGETS_GREYSCALE */\n");
+      printf("// RGB8 (332) Colors\n\n");
+      printexpanded("nxgl_mxpixel_t", "Normal", 0, torgb8, "0x%02x", 16);
+      printexpanded("nxgl_mxpixel_t", "Bright", 1, torgb8, "0x%02x", 16);
+
+      printf("#  endif\n");
+      printf("#endif\n");
+      printf("#endif /* CONFIG_NXWIDGETS_RLEEXPANDED */\n\n");
+    }
+
   printf("/********************************************************************************************\n");
   printf(" * Public Bitmap Structure Definitions\n");
   printf(" ********************************************************************************************/\n\n");
@@ -540,7 +750,19 @@ int main(int argc, char **argv, char **envp)
   printf("    g_xxxNormalLut,      //          Index 0: Unselected LUT\n");
   printf("    g_xxxBrightLut,      //          Index 1: Selected LUT\n");
   printf("  },\n");
-  printf("  g_xxxRleEntries        // data   - Pointer to the beginning of the RLE data\n");
+  printf("  g_xxxRleEntries%s        // data   - Pointer to the beginning of the RLE data\n",
+         expand ? "," : "");
+
+  if (expand)
+    {
+      printf("#ifdef CONFIG_NXWIDGETS_RLEEXPANDED\n");
+      printf("  {                      // pixels - Pointers to the expanded images\n");
+      printf("    g_xxxNormalPixels,   //          Index 0: Unselected image\n");
+      printf("    g_xxxBrightPixels,   //          Index 1: Selected image\n");
+      printf("  },\n");
+      printf("#endif\n");
+    }
+
   printf("};\n\n");
 
   return 0;
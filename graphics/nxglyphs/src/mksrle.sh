@@ -25,10 +25,12 @@
 # <color1>       - Usually the primary color of the image (default, 0xff0000)
 # <color2>       - Usually the outline color of the image (default, 0x00007f)
 # <color3>       - Usually blend of color1 and color2 for low-cost anti-aliasing (default, 0x7f003f)
+# -x             - Also generate the image pre-expanded into the display format.  The
+#                  expanded image is used when CONFIG_NXWIDGETS_RLEEXPANDED is selected.
 # Output is to stdout, but may be re-directed to a file.
 
 PROGNAME=$0
-USAGE="USAGE: $PROGNAME [-d] -f <input-file> -o <output-file>"
+USAGE="USAGE: $PROGNAME [-d] [-x] -f <input-file> -o <output-file>"
 
 CFILE=mksrle.c
 TMPFILE1=_tmpfile1.c
@@ -37,12 +39,16 @@ TMPPROG=_mksrle.exe
 
 unset INFILE
 unset OUTFILE
+unset EXPAND
 
 while [ ! -z "$1" ]; do
   case $1 in
     -d )
       set -x
       ;;
+    -x )
+      EXPAND=-x
+      ;;
     -f )
       shift
       INFILE=$1
@@ -90,6 +96,6 @@ echo "typedef uint16_t guint;" >> ${TMPFILE1}
 cat ${TMPFILE1} ${INFILE} ${CFILE} > ${TMPFILE2}
 
 gcc -g -o ${TMPPROG} ${TMPFILE2}
-./${TMPPROG} > ${OUTFILE}
+./${TMPPROG} ${EXPAND} > ${OUTFILE}
 
 rm ${TMPFILE1} ${TMPFILE2}
@@ -0,0 +1,150 @@
+/////////////////////////////////////////////////////////////////////////////
+// apps/graphics/nxwidgets/UnitTests/Benchmark/benchmark_main.cxx
+//
+// Licensed to the Apache Software Foundation (ASF) under one or more
+// contributor license agreements.  See the NOTICE file distributed with
+// this work for additional information regarding copyright ownership.  The
+// ASF licenses this file to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance with the
+// License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+// Included Files
+/////////////////////////////////////////////////////////////////////////////
+
+#include <nuttx/config.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <unistd.h>
+
+#include "graphics/nxwidgets/singletons.hxx"
+
+#include "cbenchmark.hxx"
+
+/////////////////////////////////////////////////////////////////////////////
+// Public Function Prototypes
+/////////////////////////////////////////////////////////////////////////////
+
+// Suppress name-mangling
+
+extern "C" int main(int argc, char *argv[]);
+
+/////////////////////////////////////////////////////////////////////////////
+// Private Functions
+/////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+// Name: showUsage
+/////////////////////////////////////////////////////////////////////////////
+
+static void showUsage(FAR const char *progname)
+{
+  fprintf(stderr, "USAGE: %s [-n <iterations>] [-w <width>] [-h <height>]\n",
+          progname);
+  fprintf(stderr, "  -n  Iterations of each benchmark (default %d)\n",
+          CONFIG_NXWIDGETS_BENCHMARK_ITERATIONS);
+  fprintf(stderr, "  -w  Width of the memory window (default %d)\n",
+          CONFIG_NXWIDGETS_BENCHMARK_WIDTH);
+  fprintf(stderr, "  -h  Height of the memory window (default %d)\n",
+          CONFIG_NXWIDGETS_BENCHMARK_HEIGHT);
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Public Functions
+/////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+// Name: benchmark_main
+/////////////////////////////////////////////////////////////////////////////
+
+int main(int argc, char *argv[])
+{
+  int iterations = CONFIG_NXWIDGETS_BENCHMARK_ITERATIONS;
+  int width      = CONFIG_NXWIDGETS_BENCHMARK_WIDTH;
+  int height     = CONFIG_NXWIDGETS_BENCHMARK_HEIGHT;
+  int option;
+
+  while ((option = getopt(argc, argv, "n:w:h:")) != ERROR)
+    {
+      switch (option)
+        {
+          case 'n':
+            iterations = atoi(optarg);
+            break;
+
+          case 'w':
+            width = atoi(optarg);
+            break;
+
+          case 'h':
+            height = atoi(optarg);
+            break;
+
+          default:
+            showUsage(argv[0]);
+            return EXIT_FAILURE;
+        }
+    }
+
+  // The window must be big enough for the widget layout and the bitmap
+
+  if (iterations < 1 || width < 160 || height < 120)
+    {
+      showUsage(argv[0]);
+      return EXIT_FAILURE;
+    }
+
+  // The widgets need the default style and the other singletons
+
+  bool singletons = (g_defaultWidgetStyle == NULL);
+  if (singletons)
+    {
+      instantiateSingletons();
+    }
+
+  CBenchmark *benchmark = new CBenchmark(width, height, iterations);
+  if (!benchmark->create())
+    {
+      fprintf(stderr, "benchmark_main: Failed to create the widgets\n");
+      delete benchmark;
+      return EXIT_FAILURE;
+    }
+
+  // Timings are meaningless if the drawing is wrong
+
+  if (!benchmark->checkClipping())
+    {
+      fprintf(stderr, "benchmark_main: Drawing is not clipped\n");
+      delete benchmark;
+      return EXIT_FAILURE;
+    }
+
+  benchmark->printHeader();
+  benchmark->benchFill();
+  benchmark->benchText();
+  benchmark->benchBitmap();
+  benchmark->benchListScroll();
+  benchmark->benchTextAppend();
+  benchmark->benchRedraw();
+
+  delete benchmark;
+
+  if (singletons)
+    {
+      freeSingletons();
+    }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,416 @@
+/////////////////////////////////////////////////////////////////////////////
+// apps/graphics/nxwidgets/UnitTests/Benchmark/cbenchmark.cxx
+//
+// Licensed to the Apache Software Foundation (ASF) under one or more
+// contributor license agreements.  See the NOTICE file distributed with
+// this work for additional information regarding copyright ownership.  The
+// ASF licenses this file to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance with the
+// License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+// Included Files
+/////////////////////////////////////////////////////////////////////////////
+
+#include <nuttx/config.h>
+
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+
+#include <nuttx/nx/nxglib.h>
+#include <nuttx/nx/nxfonts.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/cgraphicsport.hxx"
+#include "graphics/nxwidgets/cnxstring.hxx"
+#include "graphics/nxwidgets/crect.hxx"
+
+#include "cbenchmark.hxx"
+
+/////////////////////////////////////////////////////////////////////////////
+// Definitions
+/////////////////////////////////////////////////////////////////////////////
+
+#ifdef CONFIG_CLOCK_MONOTONIC
+#  define BENCHMARK_CLOCK CLOCK_MONOTONIC
+#else
+#  define BENCHMARK_CLOCK CLOCK_REALTIME
+#endif
+
+#define BENCHMARK_IMAGE_SIZE 64
+
+/////////////////////////////////////////////////////////////////////////////
+// Private Data
+/////////////////////////////////////////////////////////////////////////////
+
+static FAR const char g_text[] = "The quick brown fox jumps over the lazy dog";
+
+/////////////////////////////////////////////////////////////////////////////
+// CBenchmark Method Implementations
+/////////////////////////////////////////////////////////////////////////////
+
+// CBenchmark Constructor
+
+CBenchmark::CBenchmark(nxgl_coord_t width, nxgl_coord_t height,
+                       int iterations)
+{
+  m_widgetControl = NULL;
+  m_window        = NULL;
+  m_font          = NULL;
+  m_label         = NULL;
+  m_button        = NULL;
+  m_listBox       = NULL;
+  m_textBox       = NULL;
+  m_progressBar   = NULL;
+  m_image         = NULL;
+  m_width         = width;
+  m_height        = height;
+  m_iterations    = iterations > 0 ? iterations : 1;
+}
+
+// CBenchmark Destructor
+
+CBenchmark::~CBenchmark(void)
+{
+  // Deleting the widget control also destroys all of its widgets
+
+  delete m_widgetControl;
+  delete m_window;
+  delete m_font;
+  delete[] m_image;
+}
+
+// Create the window and its widgets
+
+bool CBenchmark::create(void)
+{
+  // Create the widget control and give it the geometry that the NX server
+  // would normally report
+
+  m_widgetControl = new CWidgetControl((FAR const CWidgetStyle *)NULL);
+  if (!m_widgetControl)
+    {
+      return false;
+    }
+
+  struct nxgl_size_s size;
+  size.w = m_width;
+  size.h = m_height;
+
+  struct nxgl_point_s pos;
+  pos.x = 0;
+  pos.y = 0;
+
+  struct nxgl_rect_s bounds;
+  bounds.pt1.x = 0;
+  bounds.pt1.y = 0;
+  bounds.pt2.x = m_width - 1;
+  bounds.pt2.y = m_height - 1;
+
+  m_widgetControl->geometryEvent((NXHANDLE)0, &size, &pos, &bounds);
+
+  // Create the memory window and draw on it
+
+  m_window = new CMemoryWindow(m_widgetControl, m_width, m_height);
+  if (!m_window || !m_widgetControl->createGraphicsPort(m_window))
+    {
+      return false;
+    }
+
+  m_font = new CNxFont((enum nx_fontid_e)CONFIG_NXWIDGETS_DEFAULT_FONTID,
+                       CONFIG_NXWIDGETS_DEFAULT_FONTCOLOR,
+                       CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
+
+  // Create an image with a simple pattern
+
+  m_image = new nxwidget_pixel_t[BENCHMARK_IMAGE_SIZE * BENCHMARK_IMAGE_SIZE];
+  for (int i = 0; i < BENCHMARK_IMAGE_SIZE * BENCHMARK_IMAGE_SIZE; i++)
+    {
+      m_image[i] = (nxwidget_pixel_t)(i * 2654435761u);
+    }
+
+  // Lay out a screen of widgets: a label and a button along the top, a
+  // list box and a text box side by side, and a progress bar at the bottom
+
+  nxgl_coord_t barHeight = 24;
+  nxgl_coord_t panelY    = barHeight;
+  nxgl_coord_t panelH    = m_height - 2 * barHeight;
+  nxgl_coord_t halfWidth = m_width / 2;
+
+  m_label = new CLabel(m_widgetControl, 0, 0, m_width - 80, barHeight,
+                       CNxString("NXWidgets Benchmark"));
+  m_button = new CButton(m_widgetControl, m_width - 80, 0, 80, barHeight,
+                         CNxString("Button"));
+  m_listBox = new CListBox(m_widgetControl, 0, panelY, halfWidth, panelH);
+  m_textBox = new CMultiLineTextBox(m_widgetControl, halfWidth, panelY,
+                                    m_width - halfWidth, panelH,
+                                    CNxString(""), 0, 200);
+  m_progressBar = new CProgressBar(m_widgetControl, 0, m_height - barHeight,
+                                   m_width, barHeight);
+
+  if (!m_label || !m_button || !m_listBox || !m_textBox || !m_progressBar)
+    {
+      return false;
+    }
+
+  for (int i = 0; i < 200; i++)
+    {
+      char option[32];
+      snprintf(option, sizeof(option), "Option %d", i);
+      m_listBox->addOption(CNxString(option), i);
+    }
+
+  for (int i = 0; i < 40; i++)
+    {
+      m_textBox->appendText(CNxString(g_text));
+      m_textBox->appendText(CNxString("\n"));
+    }
+
+  m_progressBar->setMinimumValue(0);
+  m_progressBar->setMaximumValue(100);
+  m_progressBar->setValue(50);
+
+  m_label->enableDrawing();
+  m_button->enableDrawing();
+  m_listBox->enableDrawing();
+  m_textBox->enableDrawing();
+  m_progressBar->enableDrawing();
+  return true;
+}
+
+// Check that lines and circles crossing the clipping rectangle (as in a
+// damage redraw) do not draw outside of it.  Returns false on failure.
+
+bool CBenchmark::checkClipping(void)
+{
+  CGraphicsPort *port = m_widgetControl->getGraphicsPort();
+  const nxgl_mxpixel_t background = 0;
+  const nxgl_mxpixel_t color      = 1;
+
+  port->drawFilledRect(0, 0, m_width, m_height, background);
+
+  CRect clipRect(m_width / 4, m_height / 4, m_width / 2, m_height / 2);
+  port->setClipRect(clipRect);
+
+  // A line through the whole window and a circle on the clip corner
+
+  port->drawLine(0, 0, m_width - 1, m_height - 1, color,
+                 INxWindow::LINECAP_NONE);
+
+  struct nxgl_point_s center;
+  center.x = clipRect.getX();
+  center.y = clipRect.getY();
+  port->drawFilledCircle(&center, 16, color);
+
+  port->clearClipRect();
+
+  // Nothing may be drawn outside of the clipping rectangle, and something
+  // must be drawn inside of it
+
+  FAR const nxwidget_pixel_t *fb = m_window->getFramebuffer();
+  int inside = 0;
+
+  for (nxgl_coord_t y = 0; y < m_height; y++)
+    {
+      for (nxgl_coord_t x = 0; x < m_width; x++)
+        {
+          if (fb[y * m_width + x] != (nxwidget_pixel_t)background)
+            {
+              if (!clipRect.contains(x, y))
+                {
+                  printf("# clip check failed at %d,%d\n", x, y);
+                  return false;
+                }
+
+              inside++;
+            }
+        }
+    }
+
+  if (inside == 0)
+    {
+      printf("# clip check failed: nothing drawn\n");
+      return false;
+    }
+
+  return true;
+}
+
+// Print the configuration and the column names
+
+void CBenchmark::printHeader(void)
+{
+  printf("# width=%d height=%d bpp=%d iterations=%d\n",
+         m_width, m_height, CONFIG_NXWIDGETS_BPP, m_iterations);
+  printf("# name,iterations,total_us,ns_per_op,fill,bitmap,move,getrect,other\n");
+}
+
+// Start timing a benchmark
+
+void CBenchmark::begin(void)
+{
+  // Send anything left over from the previous benchmark
+
+  m_widgetControl->pollEvents();
+  m_window->resetCallCounts();
+  clock_gettime(BENCHMARK_CLOCK, &m_startTime);
+}
+
+// Finish timing a benchmark and report the results
+
+void CBenchmark::end(FAR const char *name)
+{
+  // Include the cost of any deferred drawing
+
+  m_widgetControl->pollEvents();
+
+  struct timespec endTime;
+  clock_gettime(BENCHMARK_CLOCK, &endTime);
+
+  uint64_t nsec = (uint64_t)(endTime.tv_sec - m_startTime.tv_sec) *
+                  1000000000ull + endTime.tv_nsec - m_startTime.tv_nsec;
+
+  struct SNxCallCounts counts;
+  m_window->getCallCounts(&counts);
+
+  printf("%s,%d,%lu,%lu,%lu,%lu,%lu,%lu,%lu\n", name, m_iterations,
+         (unsigned long)(nsec / 1000),
+         (unsigned long)(nsec / m_iterations),
+         (unsigned long)counts.fill, (unsigned long)counts.bitmap,
+         (unsigned long)counts.move, (unsigned long)counts.getRect,
+         (unsigned long)counts.other);
+}
+
+// Fill the whole window
+
+void CBenchmark::benchFill(void)
+{
+  CGraphicsPort *port = m_widgetControl->getGraphicsPort();
+
+  begin();
+  for (int i = 0; i < m_iterations; i++)
+    {
+      port->drawFilledRect(0, 0, m_width, m_height, (nxgl_mxpixel_t)i);
+    }
+
+  end("fill");
+}
+
+// Draw a line of text
+
+void CBenchmark::benchText(void)
+{
+  CGraphicsPort *port = m_widgetControl->getGraphicsPort();
+  CNxString text(g_text);
+  CRect bound(0, 0, m_width, m_height);
+
+  begin();
+  for (int i = 0; i < m_iterations; i++)
+    {
+      struct nxgl_point_s pos;
+      pos.x = 4;
+      pos.y = (i * m_font->getHeight()) % (m_height - m_font->getHeight());
+      port->drawText(&pos, &bound, m_font, text);
+    }
+
+  end("text");
+}
+
+// Draw a 64x64 bitmap
+
+void CBenchmark::benchBitmap(void)
+{
+  CGraphicsPort *port = m_widgetControl->getGraphicsPort();
+
+  struct SBitmap bitmap;
+  bitmap.bpp    = CONFIG_NXWIDGETS_BPP;
+  bitmap.fmt    = CONFIG_NXWIDGETS_FMT;
+  bitmap.width  = BENCHMARK_IMAGE_SIZE;
+  bitmap.height = BENCHMARK_IMAGE_SIZE;
+  bitmap.stride = BENCHMARK_IMAGE_SIZE * sizeof(nxwidget_pixel_t);
+  bitmap.data   = m_image;
+
+  nxgl_coord_t xrange = m_width - BENCHMARK_IMAGE_SIZE;
+  nxgl_coord_t yrange = m_height - BENCHMARK_IMAGE_SIZE;
+
+  begin();
+  for (int i = 0; i < m_iterations; i++)
+    {
+      port->drawBitmap((i * 37) % xrange, (i * 23) % yrange,
+                       BENCHMARK_IMAGE_SIZE, BENCHMARK_IMAGE_SIZE,
+                       &bitmap, 0, 0);
+    }
+
+  end("bitmap");
+}
+
+// Scroll a list box by one option, jumping back to the top at the end
+
+void CBenchmark::benchListScroll(void)
+{
+  m_listBox->redraw();
+
+  int32_t step   = m_listBox->getOptionHeight();
+  int32_t bottom = m_listBox->getHeight() - m_listBox->getCanvasHeight();
+
+  begin();
+  for (int i = 0; i < m_iterations; i++)
+    {
+      if (m_listBox->getCanvasY() - step < bottom)
+        {
+          m_listBox->scroll(0, -m_listBox->getCanvasY());
+        }
+      else
+        {
+          m_listBox->scroll(0, -step);
+        }
+    }
+
+  end("listscroll");
+}
+
+// Append a line to a multi-line text box
+
+void CBenchmark::benchTextAppend(void)
+{
+  CNxString line(g_text);
+  line.append(CNxString("\n"));
+
+  m_textBox->redraw();
+
+  begin();
+  for (int i = 0; i < m_iterations; i++)
+    {
+      m_textBox->appendText(line);
+    }
+
+  end("textappend");
+}
+
+// Redraw every widget in the window
+
+void CBenchmark::benchRedraw(void)
+{
+  begin();
+  for (int i = 0; i < m_iterations; i++)
+    {
+      m_label->redraw();
+      m_button->redraw();
+      m_listBox->redraw();
+      m_textBox->redraw();
+      m_progressBar->redraw();
+    }
+
+  end("redraw");
+}
@@ -0,0 +1,131 @@
+/////////////////////////////////////////////////////////////////////////////
+// apps/graphics/nxwidgets/UnitTests/Benchmark/cbenchmark.hxx
+//
+// Licensed to the Apache Software Foundation (ASF) under one or more
+// contributor license agreements.  See the NOTICE file distributed with
+// this work for additional information regarding copyright ownership.  The
+// ASF licenses this file to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance with the
+// License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __APPS_GRAPHICS_NXWIDGETS_UNITTESTS_BENCHMARK_CBENCHMARK_HXX
+#define __APPS_GRAPHICS_NXWIDGETS_UNITTESTS_BENCHMARK_CBENCHMARK_HXX
+
+/////////////////////////////////////////////////////////////////////////////
+// Included Files
+/////////////////////////////////////////////////////////////////////////////
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <time.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/cwidgetcontrol.hxx"
+#include "graphics/nxwidgets/cnxfont.hxx"
+#include "graphics/nxwidgets/clabel.hxx"
+#include "graphics/nxwidgets/cbutton.hxx"
+#include "graphics/nxwidgets/clistbox.hxx"
+#include "graphics/nxwidgets/cmultilinetextbox.hxx"
+#include "graphics/nxwidgets/cprogressbar.hxx"
+
+#include "cmemorywindow.hxx"
+
+/////////////////////////////////////////////////////////////////////////////
+// Definitions
+/////////////////////////////////////////////////////////////////////////////
+// Configuration ////////////////////////////////////////////////////////////
+
+#ifndef CONFIG_HAVE_CXX
+#  error "CONFIG_HAVE_CXX must be defined"
+#endif
+
+#ifndef CONFIG_NXWIDGETS_BENCHMARK_ITERATIONS
+#  define CONFIG_NXWIDGETS_BENCHMARK_ITERATIONS 100
+#endif
+
+#ifndef CONFIG_NXWIDGETS_BENCHMARK_WIDTH
+#  define CONFIG_NXWIDGETS_BENCHMARK_WIDTH 320
+#endif
+
+#ifndef CONFIG_NXWIDGETS_BENCHMARK_HEIGHT
+#  define CONFIG_NXWIDGETS_BENCHMARK_HEIGHT 240
+#endif
+
+/////////////////////////////////////////////////////////////////////////////
+// Public Classes
+/////////////////////////////////////////////////////////////////////////////
+
+using namespace NXWidgets;
+
+// CBenchmark builds a screen of widgets in a CMemoryWindow and times
+// rendering operations on it.  Each benchmark prints one line of comma
+// separated values:
+//
+//   name,iterations,total_us,ns_per_op,fill,bitmap,move,getrect,other
+//
+// The last five fields are the number of NX calls of each kind that the
+// whole benchmark made.
+
+class CBenchmark
+{
+private:
+  CWidgetControl    *m_widgetControl;  // The controlling widget
+  CMemoryWindow     *m_window;         // The memory window
+  CNxFont           *m_font;           // Font used for text drawing
+  CLabel            *m_label;          // Widgets on the screen
+  CButton           *m_button;
+  CListBox          *m_listBox;
+  CMultiLineTextBox *m_textBox;
+  CProgressBar      *m_progressBar;
+  FAR nxwidget_pixel_t *m_image;       // Image used for bitmap drawing
+  nxgl_coord_t       m_width;          // Size of the window
+  nxgl_coord_t       m_height;
+  int                m_iterations;     // Iterations of each benchmark
+  struct timespec    m_startTime;      // Start of the current benchmark
+
+  // Start and finish timing a benchmark
+
+  void begin(void);
+  void end(FAR const char *name);
+
+public:
+  // Constructor/destructors
+
+  CBenchmark(nxgl_coord_t width, nxgl_coord_t height, int iterations);
+  ~CBenchmark(void);
+
+  // Create the window and its widgets
+
+  bool create(void);
+
+  // Check that lines and circles are clipped
+
+  bool checkClipping(void);
+
+  // Print the configuration and the column names
+
+  void printHeader(void);
+
+  // Benchmarks
+
+  void benchFill(void);        // Fill the whole window
+  void benchText(void);        // Draw a line of text
+  void benchBitmap(void);      // Draw a 64x64 bitmap
+  void benchListScroll(void);  // Scroll a list box by one option
+  void benchTextAppend(void);  // Append a line to a multi-line text box
+  void benchRedraw(void);      // Redraw every widget in the window
+};
+
+#endif // __APPS_GRAPHICS_NXWIDGETS_UNITTESTS_BENCHMARK_CBENCHMARK_HXX
@@ -0,0 +1,464 @@
+/////////////////////////////////////////////////////////////////////////////
+// apps/graphics/nxwidgets/UnitTests/Benchmark/cmemorywindow.cxx
+//
+// Licensed to the Apache Software Foundation (ASF) under one or more
+// contributor license agreements.  See the NOTICE file distributed with
+// this work for additional information regarding copyright ownership.  The
+// ASF licenses this file to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance with the
+// License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+/////////////////////////////////////////////////////////////////////////////
+// Included Files
+/////////////////////////////////////////////////////////////////////////////
+
+#include <nuttx/config.h>
+
+#include <cstring>
+#include <fixedmath.h>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/cwidgetcontrol.hxx"
+
+#include "cmemorywindow.hxx"
+
+/////////////////////////////////////////////////////////////////////////////
+// CMemoryWindow Method Implementations
+/////////////////////////////////////////////////////////////////////////////
+
+// CMemoryWindow Constructor
+
+CMemoryWindow::CMemoryWindow(CWidgetControl *widgetControl,
+                             nxgl_coord_t width, nxgl_coord_t height)
+{
+  m_widgetControl = widgetControl;
+  m_width         = width;
+  m_height        = height;
+
+  m_fb = new nxwidget_pixel_t[(size_t)width * height];
+  memset(m_fb, 0, (size_t)width * height * sizeof(nxwidget_pixel_t));
+
+  resetCallCounts();
+}
+
+// CMemoryWindow Destructor
+
+CMemoryWindow::~CMemoryWindow(void)
+{
+  delete[] m_fb;
+}
+
+// Reset the call counts
+
+void CMemoryWindow::resetCallCounts(void)
+{
+  memset(&m_counts, 0, sizeof(struct SNxCallCounts));
+}
+
+// Clip a rectangle to the window.  Returns false if nothing is left
+
+bool CMemoryWindow::clip(FAR struct nxgl_rect_s *rect) const
+{
+  if (rect->pt1.x < 0)
+    {
+      rect->pt1.x = 0;
+    }
+
+  if (rect->pt1.y < 0)
+    {
+      rect->pt1.y = 0;
+    }
+
+  if (rect->pt2.x >= m_width)
+    {
+      rect->pt2.x = m_width - 1;
+    }
+
+  if (rect->pt2.y >= m_height)
+    {
+      rect->pt2.y = m_height - 1;
+    }
+
+  return rect->pt1.x <= rect->pt2.x && rect->pt1.y <= rect->pt2.y;
+}
+
+// Fill a rectangle in the framebuffer
+
+void CMemoryWindow::renderRect(FAR const struct nxgl_rect_s *pRect,
+                               nxgl_mxpixel_t color)
+{
+  struct nxgl_rect_s rect = *pRect;
+  if (clip(&rect))
+    {
+      for (nxgl_coord_t y = rect.pt1.y; y <= rect.pt2.y; y++)
+        {
+          FAR nxwidget_pixel_t *dest = &m_fb[y * m_width + rect.pt1.x];
+          for (nxgl_coord_t x = rect.pt1.x; x <= rect.pt2.x; x++)
+            {
+              *dest++ = (nxwidget_pixel_t)color;
+            }
+        }
+    }
+}
+
+// Fill a trapezoid in the framebuffer, one row at a time
+
+void CMemoryWindow::renderTrapezoid(FAR const struct nxgl_rect_s *pClip,
+                                    FAR const struct nxgl_trapezoid_s *pTrap,
+                                    nxgl_mxpixel_t color)
+{
+  struct nxgl_rect_s bounds;
+  bounds.pt1.x = 0;
+  bounds.pt1.y = 0;
+  bounds.pt2.x = m_width - 1;
+  bounds.pt2.y = m_height - 1;
+
+  if (pClip)
+    {
+      nxgl_rectintersect(&bounds, &bounds, pClip);
+    }
+
+  nxgl_coord_t y1 = pTrap->top.y;
+  nxgl_coord_t y2 = pTrap->bot.y;
+  if (y1 > y2 || nxgl_nullrect(&bounds))
+    {
+      return;
+    }
+
+  int   nrows = y2 - y1 + 1;
+  b16_t x1    = pTrap->top.x1;
+  b16_t x2    = pTrap->top.x2;
+  b16_t dx1dy = 0;
+  b16_t dx2dy = 0;
+
+  if (nrows > 1)
+    {
+      dx1dy = (pTrap->bot.x1 - pTrap->top.x1) / (nrows - 1);
+      dx2dy = (pTrap->bot.x2 - pTrap->top.x2) / (nrows - 1);
+    }
+
+  for (nxgl_coord_t y = y1; y <= y2; y++, x1 += dx1dy, x2 += dx2dy)
+    {
+      if (y < bounds.pt1.y || y > bounds.pt2.y)
+        {
+          continue;
+        }
+
+      nxgl_coord_t ix1 = b16toi(x1 + b16HALF);
+      nxgl_coord_t ix2 = b16toi(x2 + b16HALF);
+
+      if (ix1 > ix2)
+        {
+          nxgl_coord_t tmp = ix1;
+          ix1 = ix2;
+          ix2 = tmp;
+        }
+
+      ix1 = ngl_max(ix1, bounds.pt1.x);
+      ix2 = ngl_min(ix2, bounds.pt2.x);
+
+      FAR nxwidget_pixel_t *dest = &m_fb[y * m_width + ix1];
+      for (nxgl_coord_t x = ix1; x <= ix2; x++)
+        {
+          *dest++ = (nxwidget_pixel_t)color;
+        }
+    }
+}
+
+// Fill a circle in the framebuffer
+
+void CMemoryWindow::renderCircle(FAR const struct nxgl_point_s *center,
+                                 nxgl_coord_t radius, nxgl_mxpixel_t color)
+{
+  struct nxgl_trapezoid_s traps[NCIRCLE_TRAPS];
+  nxgl_circletraps(center, radius, traps);
+
+  for (int i = 0; i < NCIRCLE_TRAPS; i++)
+    {
+      renderTrapezoid((FAR const struct nxgl_rect_s *)0, &traps[i], color);
+    }
+}
+
+// The window is always open, visible and at the origin
+
+bool CMemoryWindow::open(void)
+{
+  return true;
+}
+
+CWidgetControl *CMemoryWindow::getWidgetControl(void) const
+{
+  return m_widgetControl;
+}
+
+void CMemoryWindow::synchronize(void)
+{
+}
+
+bool CMemoryWindow::requestPosition(void)
+{
+  return true;
+}
+
+bool CMemoryWindow::getPosition(FAR struct nxgl_point_s *pPos)
+{
+  pPos->x = 0;
+  pPos->y = 0;
+  return true;
+}
+
+bool CMemoryWindow::getSize(FAR struct nxgl_size_s *pSize)
+{
+  pSize->w = m_width;
+  pSize->h = m_height;
+  return true;
+}
+
+bool CMemoryWindow::setPosition(FAR const struct nxgl_point_s *pPos)
+{
+  return false;
+}
+
+bool CMemoryWindow::setSize(FAR const struct nxgl_size_s *pSize)
+{
+  return false;
+}
+
+bool CMemoryWindow::raise(void)
+{
+  return true;
+}
+
+bool CMemoryWindow::lower(void)
+{
+  return true;
+}
+
+bool CMemoryWindow::isVisible(void)
+{
+  return true;
+}
+
+bool CMemoryWindow::show(void)
+{
+  return true;
+}
+
+bool CMemoryWindow::hide(void)
+{
+  return false;
+}
+
+bool CMemoryWindow::modal(bool enable)
+{
+  return false;
+}
+
+#ifdef CONFIG_NXTERM_NXKBDIN
+void CMemoryWindow::redirectNxTerm(NXTERM handle)
+{
+}
+#endif
+
+// Drawing operations
+
+bool CMemoryWindow::setPixel(FAR const struct nxgl_point_s *pPos,
+                             nxgl_mxpixel_t color)
+{
+  m_counts.other++;
+
+  if (pPos->x >= 0 && pPos->x < m_width &&
+      pPos->y >= 0 && pPos->y < m_height)
+    {
+      m_fb[pPos->y * m_width + pPos->x] = (nxwidget_pixel_t)color;
+    }
+
+  return true;
+}
+
+bool CMemoryWindow::fill(FAR const struct nxgl_rect_s *pRect,
+                         nxgl_mxpixel_t color)
+{
+  m_counts.fill++;
+  renderRect(pRect, color);
+  return true;
+}
+
+void CMemoryWindow::getRectangle(FAR const struct nxgl_rect_s *rect,
+                                 struct SBitmap *dest)
+{
+  m_counts.getRect++;
+
+  struct nxgl_rect_s src = *rect;
+  if (clip(&src))
+    {
+      size_t nbytes = (src.pt2.x - src.pt1.x + 1) * sizeof(nxwidget_pixel_t);
+      for (nxgl_coord_t y = src.pt1.y; y <= src.pt2.y; y++)
+        {
+          FAR uint8_t *row = (FAR uint8_t *)dest->data +
+                             (y - rect->pt1.y) * dest->stride +
+                             (src.pt1.x - rect->pt1.x) *
+                             sizeof(nxwidget_pixel_t);
+          memcpy(row, &m_fb[y * m_width + src.pt1.x], nbytes);
+        }
+    }
+}
+
+bool CMemoryWindow::fillTrapezoid(FAR const struct nxgl_rect_s *pClip,
+                                  FAR const struct nxgl_trapezoid_s *pTrap,
+                                  nxgl_mxpixel_t color)
+{
+  m_counts.other++;
+  renderTrapezoid(pClip, pTrap, color);
+  return true;
+}
+
+bool CMemoryWindow::drawLine(FAR struct nxgl_vector_s *vector,
+                             nxgl_coord_t width, nxgl_mxpixel_t color,
+                             enum ELineCaps caps)
+{
+  m_counts.other++;
+
+  // Break the line into trapezoids (or a rectangle) as NX does
+
+  struct nxgl_trapezoid_s trap[3];
+  struct nxgl_rect_s rect;
+
+  switch (nxgl_splitline(vector, trap, &rect, width))
+    {
+      case 0:
+        renderTrapezoid((FAR const struct nxgl_rect_s *)0, &trap[0], color);
+        renderTrapezoid((FAR const struct nxgl_rect_s *)0, &trap[1], color);
+        renderTrapezoid((FAR const struct nxgl_rect_s *)0, &trap[2], color);
+        break;
+
+      case 1:
+        renderTrapezoid((FAR const struct nxgl_rect_s *)0, &trap[1], color);
+        break;
+
+      case 2:
+        renderRect(&rect, color);
+        break;
+
+      default:
+        return false;
+    }
+
+  // Draw the circular caps
+
+  nxgl_coord_t radius = width >> 1;
+  if (radius > 0)
+    {
+      if ((caps & LINECAP_PT1) != 0)
+        {
+          renderCircle(&vector->pt1, radius, color);
+        }
+
+      if ((caps & LINECAP_PT2) != 0)
+        {
+          renderCircle(&vector->pt2, radius, color);
+        }
+    }
+
+  return true;
+}
+
+bool CMemoryWindow::drawFilledCircle(struct nxgl_point_s *center,
+                                     nxgl_coord_t radius,
+                                     nxgl_mxpixel_t color)
+{
+  m_counts.other++;
+  renderCircle(center, radius, color);
+  return true;
+}
+
+bool CMemoryWindow::move(FAR const struct nxgl_rect_s *pRect,
+                         FAR const struct nxgl_point_s *pOffset)
+{
+  m_counts.move++;
+
+  struct nxgl_rect_s rect = *pRect;
+  if (!clip(&rect))
+    {
+      return true;
+    }
+
+  // Copy the rows in an order that does not overwrite rows that are
+  // still to be copied
+
+  nxgl_coord_t width = rect.pt2.x - rect.pt1.x + 1;
+  nxgl_coord_t first = pOffset->y > 0 ? rect.pt2.y : rect.pt1.y;
+  nxgl_coord_t last  = pOffset->y > 0 ? rect.pt1.y : rect.pt2.y;
+  int step           = pOffset->y > 0 ? -1 : 1;
+
+  for (nxgl_coord_t y = first; ; y += step)
+    {
+      nxgl_coord_t desty = y + pOffset->y;
+      nxgl_coord_t srcx  = rect.pt1.x;
+      nxgl_coord_t destx = rect.pt1.x + pOffset->x;
+      nxgl_coord_t count = width;
+
+      if (destx < 0)
+        {
+          srcx  -= destx;
+          count += destx;
+          destx  = 0;
+        }
+
+      if (destx + count > m_width)
+        {
+          count = m_width - destx;
+        }
+
+      if (desty >= 0 && desty < m_height && count > 0)
+        {
+          memmove(&m_fb[desty * m_width + destx], &m_fb[y * m_width + srcx],
+                  count * sizeof(nxwidget_pixel_t));
+        }
+
+      if (y == last)
+        {
+          break;
+        }
+    }
+
+  return true;
+}
+
+bool CMemoryWindow::bitmap(FAR const struct nxgl_rect_s *pDest,
+                           FAR const void *pSrc,
+                           FAR const struct nxgl_point_s *pOrigin,
+                           unsigned int stride)
+{
+  m_counts.bitmap++;
+
+  struct nxgl_rect_s rect = *pDest;
+  if (clip(&rect))
+    {
+      size_t nbytes = (rect.pt2.x - rect.pt1.x + 1) *
+                      sizeof(nxwidget_pixel_t);
+
+      for (nxgl_coord_t y = rect.pt1.y; y <= rect.pt2.y; y++)
+        {
+          FAR const uint8_t *row = (FAR const uint8_t *)pSrc +
+                                   (y - pOrigin->y) * stride +
+                                   (rect.pt1.x - pOrigin->x) *
+                                   sizeof(nxwidget_pixel_t);
+          memcpy(&m_fb[y * m_width + rect.pt1.x], row, nbytes);
+        }
+    }
+
+  return true;
+}
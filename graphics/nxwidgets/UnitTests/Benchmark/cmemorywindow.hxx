@@ -0,0 +1,154 @@
+/////////////////////////////////////////////////////////////////////////////
+// apps/graphics/nxwidgets/UnitTests/Benchmark/cmemorywindow.hxx
+//
+// Licensed to the Apache Software Foundation (ASF) under one or more
+// contributor license agreements.  See the NOTICE file distributed with
+// this work for additional information regarding copyright ownership.  The
+// ASF licenses this file to you under the Apache License, Version 2.0 (the
+// "License"); you may not use this file except in compliance with the
+// License.  You may obtain a copy of the License at
+//
+//   http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+// WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+// License for the specific language governing permissions and limitations
+// under the License.
+//
+//////////////////////////////////////////////////////////////////////////////
+
+#ifndef __APPS_GRAPHICS_NXWIDGETS_UNITTESTS_BENCHMARK_CMEMORYWINDOW_HXX
+#define __APPS_GRAPHICS_NXWIDGETS_UNITTESTS_BENCHMARK_CMEMORYWINDOW_HXX
+
+/////////////////////////////////////////////////////////////////////////////
+// Included Files
+/////////////////////////////////////////////////////////////////////////////
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/inxwindow.hxx"
+#include "graphics/nxwidgets/cbitmap.hxx"
+
+/////////////////////////////////////////////////////////////////////////////
+// Definitions
+/////////////////////////////////////////////////////////////////////////////
+
+#if CONFIG_NXWIDGETS_BPP < 8
+#  error "The benchmark requires at least 8 bits per pixel"
+#endif
+
+/////////////////////////////////////////////////////////////////////////////
+// Public Types
+/////////////////////////////////////////////////////////////////////////////
+
+// The number of calls of each kind received by a CMemoryWindow
+
+struct SNxCallCounts
+{
+  uint32_t fill;       // fill()
+  uint32_t bitmap;     // bitmap()
+  uint32_t move;       // move()
+  uint32_t getRect;    // getRectangle()
+  uint32_t other;      // setPixel(), fillTrapezoid(), drawLine(), ...
+};
+
+/////////////////////////////////////////////////////////////////////////////
+// Public Classes
+/////////////////////////////////////////////////////////////////////////////
+
+using namespace NXWidgets;
+
+// CMemoryWindow is a window drawn into a framebuffer in memory.  It needs
+// no NX server or display, so the cost of the widget rendering can be
+// measured on its own.  Each call that a real window would send to the NX
+// server is counted.
+
+class CMemoryWindow : public INxWindow
+{
+private:
+  CWidgetControl       *m_widgetControl;  // The controlling widget
+  FAR nxwidget_pixel_t *m_fb;             // The framebuffer
+  nxgl_coord_t          m_width;          // Width of the window in pixels
+  nxgl_coord_t          m_height;         // Height of the window in rows
+  struct SNxCallCounts  m_counts;         // Calls received
+
+  // Clip a rectangle to the window.  Returns false if nothing is left
+
+  bool clip(FAR struct nxgl_rect_s *rect) const;
+
+  // Render into the framebuffer without counting a call
+
+  void renderRect(FAR const struct nxgl_rect_s *pRect, nxgl_mxpixel_t color);
+  void renderTrapezoid(FAR const struct nxgl_rect_s *pClip,
+                       FAR const struct nxgl_trapezoid_s *pTrap,
+                       nxgl_mxpixel_t color);
+  void renderCircle(FAR const struct nxgl_point_s *center,
+                    nxgl_coord_t radius, nxgl_mxpixel_t color);
+
+public:
+  // Constructor/destructors
+
+  CMemoryWindow(CWidgetControl *widgetControl,
+                nxgl_coord_t width, nxgl_coord_t height);
+  ~CMemoryWindow(void);
+
+  // Get and reset the call counts
+
+  inline void getCallCounts(FAR struct SNxCallCounts *counts) const
+  {
+    *counts = m_counts;
+  }
+
+  void resetCallCounts(void);
+
+  // Get the framebuffer
+
+  inline FAR const nxwidget_pixel_t *getFramebuffer(void) const
+  {
+    return m_fb;
+  }
+
+  // INxWindow methods
+
+  bool open(void);
+  CWidgetControl *getWidgetControl(void) const;
+  void synchronize(void);
+  bool requestPosition(void);
+  bool getPosition(FAR struct nxgl_point_s *pPos);
+  bool getSize(FAR struct nxgl_size_s *pSize);
+  bool setPosition(FAR const struct nxgl_point_s *pPos);
+  bool setSize(FAR const struct nxgl_size_s *pSize);
+  bool raise(void);
+  bool lower(void);
+  bool isVisible(void);
+  bool show(void);
+  bool hide(void);
+  bool modal(bool enable);
+#ifdef CONFIG_NXTERM_NXKBDIN
+  void redirectNxTerm(NXTERM handle);
+#endif
+  bool setPixel(FAR const struct nxgl_point_s *pPos, nxgl_mxpixel_t color);
+  bool fill(FAR const struct nxgl_rect_s *pRect, nxgl_mxpixel_t color);
+  void getRectangle(FAR const struct nxgl_rect_s *rect,
+                    struct SBitmap *dest);
+  bool fillTrapezoid(FAR const struct nxgl_rect_s *pClip,
+                     FAR const struct nxgl_trapezoid_s *pTrap,
+                     nxgl_mxpixel_t color);
+  bool drawLine(FAR struct nxgl_vector_s *vector, nxgl_coord_t width,
+                nxgl_mxpixel_t color, enum ELineCaps caps);
+  bool drawFilledCircle(struct nxgl_point_s *center, nxgl_coord_t radius,
+                        nxgl_mxpixel_t color);
+  bool move(FAR const struct nxgl_rect_s *pRect,
+            FAR const struct nxgl_point_s *pOffset);
+  bool bitmap(FAR const struct nxgl_rect_s *pDest, FAR const void *pSrc,
+              FAR const struct nxgl_point_s *pOrigin, unsigned int stride);
+};
+
+#endif // __APPS_GRAPHICS_NXWIDGETS_UNITTESTS_BENCHMARK_CMEMORYWINDOW_HXX
@@ -0,0 +1,690 @@
+/****************************************************************************
+ * apps/graphics/nxwidgets/src/cbufferedwindow.cxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <cstring>
+#include <sched.h>
+#include <fixedmath.h>
+#include <debug.h>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/crect.hxx"
+#include "graphics/nxwidgets/cbitmap.hxx"
+#include "graphics/nxwidgets/cbufferedwindow.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+// The number of bytes in a run of pixels.  Rows are packed, so this is not
+// npixels * sizeof(nxwidget_pixel_t) for 24-bit pixels.
+
+#define RUN_BYTES(npixels) \
+  ((((uint32_t)(npixels)) * CONFIG_NXWIDGETS_BPP + 7) >> 3)
+
+/****************************************************************************
+ * Method Implementations
+ ****************************************************************************/
+
+using namespace NXWidgets;
+
+/**
+ * Constructor.
+ *
+ * @param window The real window that receives the back buffer contents.
+ */
+
+CBufferedWindow::CBufferedWindow(INxWindow *window)
+: m_dirty(CONFIG_NXWIDGETS_DOUBLEBUFFER_NRECTS)
+{
+  m_window        = window;
+  m_buffer        = (FAR uint8_t *)0;
+  m_size.w        = 0;
+  m_size.h        = 0;
+  m_resized       = false;
+
+  m_bitmap.bpp    = CONFIG_NXWIDGETS_BPP;
+  m_bitmap.fmt    = CONFIG_NXWIDGETS_FMT;
+  m_bitmap.width  = 0;
+  m_bitmap.height = 0;
+  m_bitmap.stride = 0;
+  m_bitmap.data   = (FAR const void *)0;
+}
+
+/**
+ * Destructor.
+ */
+
+CBufferedWindow::~CBufferedWindow(void)
+{
+  if (m_buffer)
+    {
+      delete[] m_buffer;
+    }
+}
+
+/**
+ * Report a new window size.
+ *
+ * @param size The new size of the window.
+ */
+
+void CBufferedWindow::resize(FAR const struct nxgl_size_s *size)
+{
+  // This may be called from the NX callback thread
+
+  sched_lock();
+  if (size->w != m_size.w || size->h != m_size.h)
+    {
+      m_size.w  = size->w;
+      m_size.h  = size->h;
+      m_resized = true;
+    }
+
+  sched_unlock();
+}
+
+/**
+ * Make sure that the back buffer matches the size of the window.
+ *
+ * @return True if the back buffer is available.
+ */
+
+bool CBufferedWindow::prepareBuffer(void)
+{
+  if (!m_resized)
+    {
+      return m_buffer != (FAR uint8_t *)0;
+    }
+
+  sched_lock();
+  struct nxgl_size_s size = m_size;
+  m_resized = false;
+  sched_unlock();
+
+  if (m_buffer)
+    {
+      delete[] m_buffer;
+      m_buffer = (FAR uint8_t *)0;
+    }
+
+  m_dirty.clear();
+
+  if (size.w <= 0 || size.h <= 0)
+    {
+      return false;
+    }
+
+  uint16_t stride = ((uint32_t)size.w * CONFIG_NXWIDGETS_BPP + 7) >> 3;
+  m_buffer = new uint8_t[(uint32_t)stride * size.h];
+  if (!m_buffer)
+    {
+      // Fall back to drawing directly in the window
+
+      gerr("ERROR: Failed to allocate a %dx%d back buffer\n", size.w, size.h);
+      return false;
+    }
+
+  m_bitmap.width  = size.w;
+  m_bitmap.height = size.h;
+  m_bitmap.stride = stride;
+  m_bitmap.data   = (FAR const void *)m_buffer;
+
+#ifdef CONFIG_NX_WRITEONLY
+  memset(m_buffer, 0, (uint32_t)stride * size.h);
+#else
+  // Start with what is currently in the window so that later reads
+  // (such as transparent text) see the same contents as the display.
+
+  struct nxgl_rect_s rect;
+  rect.pt1.x = 0;
+  rect.pt1.y = 0;
+  rect.pt2.x = size.w - 1;
+  rect.pt2.y = size.h - 1;
+
+  m_window->getRectangle(&rect, &m_bitmap);
+#endif
+  return true;
+}
+
+/**
+ * Limit a rectangle to the back buffer.
+ *
+ * @param rect The rectangle to clip.
+ * @return False if nothing remains of the rectangle.
+ */
+
+bool CBufferedWindow::clipToBuffer(FAR struct nxgl_rect_s *rect) const
+{
+  struct nxgl_rect_s bounds;
+  bounds.pt1.x = 0;
+  bounds.pt1.y = 0;
+  bounds.pt2.x = m_bitmap.width - 1;
+  bounds.pt2.y = m_bitmap.height - 1;
+
+  nxgl_rectintersect(rect, rect, &bounds);
+  return !nxgl_nullrect(rect);
+}
+
+/**
+ * Record that a region of the back buffer has been modified.
+ *
+ * @param rect The modified region.
+ */
+
+void CBufferedWindow::markDirty(FAR const struct nxgl_rect_s *rect)
+{
+  // The dirty list is shared with the NX callback thread (see invalidate())
+
+  sched_lock();
+  m_dirty.addRect(CRect(rect));
+  sched_unlock();
+}
+
+/**
+ * Fill a horizontal run of pixels in the back buffer.
+ */
+
+void CBufferedWindow::fillRun(nxgl_coord_t x1, nxgl_coord_t x2,
+                              nxgl_coord_t y, nxwidget_pixel_t color)
+{
+#if CONFIG_NXWIDGETS_BPP == 24
+  // Packed 24-bit pixels, least significant byte first as NX stores them
+
+  FAR uint8_t *dest = pixelAddress(x1, y);
+  for (nxgl_coord_t x = x1; x <= x2; x++)
+    {
+      *dest++ = (uint8_t)color;
+      *dest++ = (uint8_t)(color >> 8);
+      *dest++ = (uint8_t)(color >> 16);
+    }
+#else
+  FAR nxwidget_pixel_t *dest = (FAR nxwidget_pixel_t *)pixelAddress(x1, y);
+  for (nxgl_coord_t x = x1; x <= x2; x++)
+    {
+      *dest++ = color;
+    }
+#endif
+}
+
+/**
+ * Mark a region of the window as needing to be sent again from the back
+ * buffer.
+ *
+ * @param rect The window-relative region.
+ */
+
+void CBufferedWindow::invalidate(FAR const struct nxgl_rect_s *rect)
+{
+  markDirty(rect);
+}
+
+/**
+ * Send all modified regions of the back buffer to the real window.
+ *
+ * @return The number of regions that were sent.
+ */
+
+int CBufferedWindow::flush(void)
+{
+  if (!m_buffer)
+    {
+      return 0;
+    }
+
+  // Take the current dirty list
+
+  CRect dirty[CONFIG_NXWIDGETS_DOUBLEBUFFER_NRECTS];
+
+  sched_lock();
+  int nDirty = m_dirty.getRectCount();
+  for (int i = 0; i < nDirty; i++)
+    {
+      dirty[i] = m_dirty.getRect(i);
+    }
+
+  m_dirty.clear();
+  sched_unlock();
+
+  // The back buffer origin is the window origin
+
+  struct nxgl_point_s origin;
+  origin.x = 0;
+  origin.y = 0;
+
+  int nSent = 0;
+  for (int i = 0; i < nDirty; i++)
+    {
+      struct nxgl_rect_s rect;
+      dirty[i].getNxRect(&rect);
+
+      if (clipToBuffer(&rect))
+        {
+          if (!m_window->bitmap(&rect, (FAR const void *)m_buffer, &origin,
+                                m_bitmap.stride))
+            {
+              gerr("ERROR: INxWindow::bitmap failed\n");
+            }
+
+          nSent++;
+        }
+    }
+
+  return nSent;
+}
+
+/**
+ * Set an individual pixel in the back buffer.
+ *
+ * @param pPos The location of the pixel to be filled.
+ * @param color The color to use in the fill.
+ * @return True on success; false on failure.
+ */
+
+bool CBufferedWindow::setPixel(FAR const struct nxgl_point_s *pPos,
+                               nxgl_mxpixel_t color)
+{
+  if (!prepareBuffer())
+    {
+      return m_window->setPixel(pPos, color);
+    }
+
+  struct nxgl_rect_s rect;
+  rect.pt1 = *pPos;
+  rect.pt2 = *pPos;
+
+  if (clipToBuffer(&rect))
+    {
+      fillRun(pPos->x, pPos->x, pPos->y, (nxwidget_pixel_t)color);
+      markDirty(&rect);
+    }
+
+  return true;
+}
+
+/**
+ * Fill a rectangle in the back buffer.
+ *
+ * @param pRect The location to be filled.
+ * @param color The color to use in the fill.
+ * @return True on success; false on failure.
+ */
+
+bool CBufferedWindow::fill(FAR const struct nxgl_rect_s *pRect,
+                           nxgl_mxpixel_t color)
+{
+  if (!prepareBuffer())
+    {
+      return m_window->fill(pRect, color);
+    }
+
+  struct nxgl_rect_s rect = *pRect;
+  if (!clipToBuffer(&rect))
+    {
+      return true;
+    }
+
+  // Fill the first row, then copy it to the remaining rows
+
+  fillRun(rect.pt1.x, rect.pt2.x, rect.pt1.y, (nxwidget_pixel_t)color);
+
+  FAR const uint8_t *first = pixelAddress(rect.pt1.x, rect.pt1.y);
+  size_t nbytes = RUN_BYTES(rect.pt2.x - rect.pt1.x + 1);
+
+  for (nxgl_coord_t y = rect.pt1.y + 1; y <= rect.pt2.y; y++)
+    {
+      memcpy(pixelAddress(rect.pt1.x, y), first, nbytes);
+    }
+
+  markDirty(&rect);
+  return true;
+}
+
+/**
+ * Get the contents of a region of the back buffer.  Parts of the region
+ * that lie outside of the window are not modified in dest.
+ *
+ * @param rect The location to be copied
+ * @param dest The destination bitmap.
+ */
+
+void CBufferedWindow::getRectangle(FAR const struct nxgl_rect_s *rect,
+                                   struct SBitmap *dest)
+{
+  if (!prepareBuffer())
+    {
+      m_window->getRectangle(rect, dest);
+      return;
+    }
+
+  struct nxgl_rect_s clipped = *rect;
+  if (!clipToBuffer(&clipped))
+    {
+      return;
+    }
+
+  size_t nbytes = RUN_BYTES(clipped.pt2.x - clipped.pt1.x + 1);
+
+  for (nxgl_coord_t y = clipped.pt1.y; y <= clipped.pt2.y; y++)
+    {
+      FAR uint8_t *destLine = (FAR uint8_t *)dest->data +
+                              (y - rect->pt1.y) * dest->stride;
+
+      memcpy(destLine + RUN_BYTES(clipped.pt1.x - rect->pt1.x),
+             pixelAddress(clipped.pt1.x, y), nbytes);
+    }
+}
+
+/**
+ * Fill a trapezoidal region in the back buffer.
+ *
+ * @param pClip Clipping rectangle relative to window (may be null).
+ * @param pTrap The trapezoidal region to be filled.
+ * @param color The color to use in the fill.
+ * @return True on success; false on failure.
+ */
+
+bool CBufferedWindow::fillTrapezoid(FAR const struct nxgl_rect_s *pClip,
+                                    FAR const struct nxgl_trapezoid_s *pTrap,
+                                    nxgl_mxpixel_t color)
+{
+  if (!prepareBuffer())
+    {
+      return m_window->fillTrapezoid(pClip, pTrap, color);
+    }
+
+  // Get the clipping region
+
+  struct nxgl_rect_s bounds;
+  bounds.pt1.x = 0;
+  bounds.pt1.y = 0;
+  bounds.pt2.x = m_bitmap.width - 1;
+  bounds.pt2.y = m_bitmap.height - 1;
+
+  if (pClip)
+    {
+      nxgl_rectintersect(&bounds, &bounds, pClip);
+    }
+
+  nxgl_coord_t y1 = pTrap->top.y;
+  nxgl_coord_t y2 = pTrap->bot.y;
+  if (y1 > y2 || nxgl_nullrect(&bounds))
+    {
+      return true;
+    }
+
+  // Step the edges one row at a time
+
+  int   nrows = y2 - y1 + 1;
+  b16_t x1    = pTrap->top.x1;
+  b16_t x2    = pTrap->top.x2;
+  b16_t dx1dy = 0;
+  b16_t dx2dy = 0;
+
+  if (nrows > 1)
+    {
+      dx1dy = (pTrap->bot.x1 - pTrap->top.x1) / (nrows - 1);
+      dx2dy = (pTrap->bot.x2 - pTrap->top.x2) / (nrows - 1);
+    }
+
+  if (y2 > bounds.pt2.y)
+    {
+      y2 = bounds.pt2.y;
+    }
+
+  struct nxgl_rect_s dirty;
+  dirty.pt1.x = bounds.pt2.x + 1;
+  dirty.pt1.y = ngl_max(y1, bounds.pt1.y);
+  dirty.pt2.x = bounds.pt1.x - 1;
+  dirty.pt2.y = y2;
+
+  for (nxgl_coord_t y = y1; y <= y2; y++, x1 += dx1dy, x2 += dx2dy)
+    {
+      // Skip rows above the clipping region
+
+      if (y < bounds.pt1.y)
+        {
+          continue;
+        }
+
+      nxgl_coord_t ix1 = b16toi(x1 + b16HALF);
+      nxgl_coord_t ix2 = b16toi(x2 + b16HALF);
+
+      if (ix1 > ix2)
+        {
+          nxgl_coord_t tmp = ix1;
+          ix1 = ix2;
+          ix2 = tmp;
+        }
+
+      ix1 = ngl_max(ix1, bounds.pt1.x);
+      ix2 = ngl_min(ix2, bounds.pt2.x);
+
+      if (ix1 <= ix2)
+        {
+          fillRun(ix1, ix2, y, (nxwidget_pixel_t)color);
+          dirty.pt1.x = ngl_min(dirty.pt1.x, ix1);
+          dirty.pt2.x = ngl_max(dirty.pt2.x, ix2);
+        }
+    }
+
+  if (!nxgl_nullrect(&dirty))
+    {
+      markDirty(&dirty);
+    }
+
+  return true;
+}
+
+/**
+ * Draw a line in the back buffer.
+ *
+ * @param vector - Describes the line to be drawn
+ * @param width  - The width of the line
+ * @param color  - The color to use to fill the line
+ * @param caps   - Draw a circular cap on the ends of the line
+ * @return True on success; false on failure.
+ */
+
+bool CBufferedWindow::drawLine(FAR struct nxgl_vector_s *vector,
+                               nxgl_coord_t width, nxgl_mxpixel_t color,
+                               enum ELineCaps caps)
+{
+  if (!prepareBuffer())
+    {
+      return m_window->drawLine(vector, width, color, caps);
+    }
+
+  // Break the line into trapezoids (or a rectangle) as NX does
+
+  struct nxgl_trapezoid_s trap[3];
+  struct nxgl_rect_s rect;
+
+  switch (nxgl_splitline(vector, trap, &rect, width))
+    {
+      case 0:
+        fillTrapezoid((FAR const struct nxgl_rect_s *)0, &trap[0], color);
+        fillTrapezoid((FAR const struct nxgl_rect_s *)0, &trap[1], color);
+        fillTrapezoid((FAR const struct nxgl_rect_s *)0, &trap[2], color);
+        break;
+
+      case 1:
+        fillTrapezoid((FAR const struct nxgl_rect_s *)0, &trap[1], color);
+        break;
+
+      case 2:
+        fill(&rect, color);
+        break;
+
+      default:
+        return false;
+    }
+
+  // Draw the circular caps
+
+  nxgl_coord_t radius = width >> 1;
+  if (radius > 0)
+    {
+      if ((caps & LINECAP_PT1) != 0)
+        {
+          drawFilledCircle(&vector->pt1, radius, color);
+        }
+
+      if ((caps & LINECAP_PT2) != 0)
+        {
+          drawFilledCircle(&vector->pt2, radius, color);
+        }
+    }
+
+  return true;
+}
+
+/**
+ * Draw a filled circle in the back buffer.
+ *
+ * @param center The window-relative coordinates of the circle center.
+ * @param radius The radius of the rectangle in pixels.
+ * @param color The color of the rectangle.
+ * @return True on success; false on failure.
+ */
+
+bool CBufferedWindow::drawFilledCircle(struct nxgl_point_s *center,
+                                       nxgl_coord_t radius,
+                                       nxgl_mxpixel_t color)
+{
+  if (!prepareBuffer())
+    {
+      return m_window->drawFilledCircle(center, radius, color);
+    }
+
+  struct nxgl_trapezoid_s traps[NCIRCLE_TRAPS];
+  nxgl_circletraps(center, radius, traps);
+
+  for (int i = 0; i < NCIRCLE_TRAPS; i++)
+    {
+      fillTrapezoid((FAR const struct nxgl_rect_s *)0, &traps[i], color);
+    }
+
+  return true;
+}
+
+/**
+ * Move a rectangular region within the back buffer.
+ *
+ * @param pRect Describes the rectangular region to move.
+ * @param pOffset The offset to move the region.
+ * @return True on success; false on failure.
+ */
+
+bool CBufferedWindow::move(FAR const struct nxgl_rect_s *pRect,
+                           FAR const struct nxgl_point_s *pOffset)
+{
+  if (!prepareBuffer())
+    {
+      return m_window->move(pRect, pOffset);
+    }
+
+  // Clip the source, then the destination, then derive the part of the
+  // source that actually lands in the window.
+
+  struct nxgl_rect_s src = *pRect;
+  if (!clipToBuffer(&src))
+    {
+      return true;
+    }
+
+  struct nxgl_rect_s dest;
+  nxgl_rectoffset(&dest, &src, pOffset->x, pOffset->y);
+  if (!clipToBuffer(&dest))
+    {
+      return true;
+    }
+
+  nxgl_rectoffset(&src, &dest, -pOffset->x, -pOffset->y);
+
+  // Copy the rows in an order that does not overwrite rows that have not
+  // yet been copied.  memmove() handles the overlap within a row.
+
+  size_t nbytes = RUN_BYTES(dest.pt2.x - dest.pt1.x + 1);
+  nxgl_coord_t nrows = dest.pt2.y - dest.pt1.y + 1;
+
+  for (nxgl_coord_t i = 0; i < nrows; i++)
+    {
+      nxgl_coord_t row = pOffset->y > 0 ? nrows - 1 - i : i;
+      memmove(pixelAddress(dest.pt1.x, dest.pt1.y + row),
+              pixelAddress(src.pt1.x, src.pt1.y + row), nbytes);
+    }
+
+  markDirty(&dest);
+  return true;
+}
+
+/**
+ * Copy a rectangular region of a larger image into the back buffer.
+ *
+ * @param pDest Describes the rectangular region that will receive the
+ *   bitmap.
+ * @param pSrc The start of the source image.
+ * @param pOrigin The origin of the upper, left-most corner of the full
+ *   bitmap in window coordinates.
+ * @param stride The width of the full source image in bytes.
+ * @return True on success; false on failure.
+ */
+
+bool CBufferedWindow::bitmap(FAR const struct nxgl_rect_s *pDest,
+                             FAR const void *pSrc,
+                             FAR const struct nxgl_point_s *pOrigin,
+                             unsigned int stride)
+{
+  if (!prepareBuffer())
+    {
+      return m_window->bitmap(pDest, pSrc, pOrigin, stride);
+    }
+
+  struct nxgl_rect_s dest = *pDest;
+  if (!clipToBuffer(&dest))
+    {
+      return true;
+    }
+
+  size_t nbytes = RUN_BYTES(dest.pt2.x - dest.pt1.x + 1);
+  FAR const uint8_t *srcLine = (FAR const uint8_t *)pSrc +
+                               (dest.pt1.y - pOrigin->y) * stride +
+                               RUN_BYTES(dest.pt1.x - pOrigin->x);
+
+  for (nxgl_coord_t y = dest.pt1.y; y <= dest.pt2.y; y++)
+    {
+      memcpy(pixelAddress(dest.pt1.x, y), srcLine, nbytes);
+      srcLine += stride;
+    }
+
+  markDirty(&dest);
+  return true;
+}
@@ -256,7 +256,7 @@ void CButton::drawBorder(CGraphicsPort *port, bool useClicked)
 
 void CButton::onClick(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -280,7 +280,7 @@ void CButton::onPreRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CButton::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -292,5 +292,5 @@ void CButton::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CButton::onReleaseOutside(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
@@ -161,7 +161,7 @@ bool CButtonArray::resizeArray(uint8_t buttonColumns, uint8_t buttonRows,
   // And go active again with a resized button array (with no labels)
 
   enableDrawing();
-  redraw();
+  invalidate();
   setRaisesEvents(true);
   return success;
 }
@@ -269,7 +269,7 @@ void CButtonArray::cursor(bool cursorOn)
       // Update only the effected button
 
       m_cursorChange = true;
-      redraw();
+      invalidate();
       m_cursorChange = false;
     }
 }
@@ -321,7 +321,7 @@ bool CButtonArray::setCursorPosition(int column, int row)
               // Yes.. clear the old cursor highlight
 
               m_cursorOn = false;
-              redraw();
+              invalidate();
             }
 
           // Set the new cursor position
@@ -336,7 +336,7 @@ bool CButtonArray::setCursorPosition(int column, int row)
               // Yes.. Set the new cursor highlight
 
               m_cursorOn = true;
-              redraw();
+              invalidate();
             }
 
           m_cursorChange = false;
@@ -389,7 +389,7 @@ void CButtonArray::getPreferredDimensions(CRect &rect) const
 void CButtonArray::setFont(CNxFont *font)
 {
   m_style.font = font;
-  redraw();
+  invalidate();
 }
 
 /**
@@ -598,7 +598,7 @@ void CButtonArray::onClick(nxgl_coord_t x, nxgl_coord_t y)
   // Redraw only the button that was clicked
 
   m_redrawButton = true;
-  redraw();
+  invalidate();
   m_redrawButton = false;
 }
 
@@ -626,7 +626,7 @@ void CButtonArray::onRelease(nxgl_coord_t x, nxgl_coord_t y)
   // Redraw only the button that was released
 
   m_redrawButton = true;
-  redraw();
+  invalidate();
   m_redrawButton = false;
 }
 
@@ -639,7 +639,7 @@ void CButtonArray::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CButtonArray::onReleaseOutside(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -669,6 +669,6 @@ bool CButtonArray::posToButton(nxgl_coord_t x, nxgl_coord_t y, int &column, int
 
 void CButtonArray::onTextChange(void)
 {
-  redraw();
+  invalidate();
   m_widgetEventHandlers->raiseValueChangeEvent();
 }
@@ -0,0 +1,233 @@
+/****************************************************************************
+ * apps/graphics/nxwidgets/src/ccachedbitmap.cxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <cstring>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "graphics/nxwidgets/ccachedbitmap.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Method Implementations
+ ****************************************************************************/
+
+using namespace NXWidgets;
+
+/**
+ * Constructor.  The normal copy of the image is made immediately.
+ *
+ * @param bitmap The bitmap to be cached.
+ */
+
+CCachedBitmap::CCachedBitmap(FAR IBitmap *bitmap) : m_bitmap(bitmap)
+{
+  m_data[0]  = (FAR uint8_t *)0;
+  m_data[1]  = (FAR uint8_t *)0;
+  m_stride   = ((size_t)bitmap->getWidth() * bitmap->getBitsPerPixel() + 7) >> 3;
+  m_selected = false;
+
+  // Convert the image using the normal colors now.  If there is not enough
+  // memory, runs will be read from the contained bitmap instead.
+
+  cacheImage(false);
+}
+
+/**
+ * Destructor.
+ */
+
+CCachedBitmap::~CCachedBitmap(void)
+{
+  if (m_data[0])
+    {
+      delete[] m_data[0];
+    }
+
+  if (m_data[1])
+    {
+      delete[] m_data[1];
+    }
+
+  delete m_bitmap;
+}
+
+/**
+ * Get the bitmap's color format.
+ *
+ * @return The bitmap's color format.
+ */
+
+const uint8_t CCachedBitmap::getColorFormat(void) const
+{
+  return m_bitmap->getColorFormat();
+}
+
+/**
+ * Get the bitmap's color format.
+ *
+ * @return The bitmap's color format.
+ */
+
+const uint8_t CCachedBitmap::getBitsPerPixel(void) const
+{
+  return m_bitmap->getBitsPerPixel();
+}
+
+/**
+ * Get the bitmap's width (in pixels/columns).
+ *
+ * @return The bitmap's width.
+ */
+
+const nxgl_coord_t CCachedBitmap::getWidth(void) const
+{
+  return m_bitmap->getWidth();
+}
+
+/**
+ * Get the bitmap's height (in rows).
+ *
+ * @return The bitmap's height.
+ */
+
+const nxgl_coord_t CCachedBitmap::getHeight(void) const
+{
+  return m_bitmap->getHeight();
+}
+
+/**
+ * Get the bitmap's width (in bytes).
+ *
+ * @return The bitmap's width.
+ */
+
+const size_t CCachedBitmap::getStride(void) const
+{
+  return m_stride;
+}
+
+/**
+ * Use the colors associated with a selected image.
+ *
+ * @param selected.  true: Use colors for a selected widget,
+ *   false: Use normal (default) colors.
+ */
+
+void CCachedBitmap::setSelected(bool selected)
+{
+  m_selected = selected;
+  m_bitmap->setSelected(selected);
+}
+
+/**
+ * Get one row from the bit map image using the selected colors.
+ *
+ * @param x The offset into the row to get
+ * @param y The row number to get
+ * @param width The number of pixels to get from the row
+ * @param data The memory location provided by the caller
+ *   in which to return the data.  This should be at least
+ *   (getWidth()*getBitsPerPixl() + 7)/8 bytes in length
+ *   and properly aligned for the pixel color format.
+ * @param True if the run was returned successfully.
+ */
+
+bool CCachedBitmap::getRun(nxgl_coord_t x, nxgl_coord_t y, nxgl_coord_t width,
+                           FAR void *data)
+{
+  // Make the copy for the current colors if this is the first time that
+  // they are used.  Otherwise, fall back to the contained bitmap.
+
+  int index = m_selected ? 1 : 0;
+  if (!m_data[index] && !cacheImage(m_selected))
+    {
+      return m_bitmap->getRun(x, y, width, data);
+    }
+
+  // Check ranges.  Casts to unsigned int are ugly but permit one-sided comparisons
+
+  nxgl_coord_t bitmapWidth = m_bitmap->getWidth();
+  if (((unsigned int)x           <  (unsigned int)bitmapWidth) &&
+      ((unsigned int)(x + width) <= (unsigned int)bitmapWidth) &&
+      ((unsigned int)y           <  (unsigned int)m_bitmap->getHeight()))
+    {
+      // Copy the run from the cached image (this will only work if bpp
+      // is an even multiple of bytes).
+
+      uint8_t bpp = m_bitmap->getBitsPerPixel();
+      FAR const uint8_t *start = m_data[index] + y * m_stride + ((x * bpp) >> 3);
+      memcpy(data, start, (width * bpp) >> 3);
+      return true;
+    }
+
+  return false;
+}
+
+/**
+ * Read the complete contained bitmap into one cached copy.
+ *
+ * @param selected True: Cache the image using the selected colors.
+ * @return True if the copy is available.
+ */
+
+bool CCachedBitmap::cacheImage(bool selected)
+{
+  nxgl_coord_t width  = m_bitmap->getWidth();
+  nxgl_coord_t height = m_bitmap->getHeight();
+
+  FAR uint8_t *image = new uint8_t[m_stride * height];
+  if (!image)
+    {
+      return false;
+    }
+
+  // Read every row of the image using the requested colors
+
+  m_bitmap->setSelected(selected);
+
+  FAR uint8_t *row = image;
+  for (nxgl_coord_t y = 0; y < height; y++, row += m_stride)
+    {
+      if (!m_bitmap->getRun(0, y, width, row))
+        {
+          m_bitmap->setSelected(m_selected);
+          delete[] image;
+          return false;
+        }
+    }
+
+  // Restore the current colors of the contained bitmap
+
+  m_bitmap->setSelected(m_selected);
+  m_data[selected ? 1 : 0] = image;
+  return true;
+}
@@ -122,7 +122,7 @@ void CCheckBox::setState(CCheckBox::CheckBoxState state)
     {
       m_state = state;
       m_widgetEventHandlers->raiseValueChangeEvent();
-      redraw();
+      invalidate();
     }
 }
 
@@ -190,7 +190,7 @@ void CCheckBox::drawContents(CGraphicsPort *port)
   // Draw the checkbox
 
   port->drawBitmap(x, y, width, height, glyph, 0, 0,
-                   CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
+                   CONFIG_NXWIDGETS_TRANSPARENT_COLOR, true);
 }
 
 /**
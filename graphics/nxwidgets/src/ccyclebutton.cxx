@@ -216,7 +216,7 @@ void CCycleButton::sort(void)
 
 void CCycleButton::handleListDataChangedEvent(const CListDataEventArgs &e)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -227,7 +227,7 @@ void CCycleButton::handleListDataChangedEvent(const CListDataEventArgs &e)
 
 void CCycleButton::handleListDataSelectionChangedEvent(const CListDataEventArgs &e)
 {
-  redraw();
+  invalidate();
   m_widgetEventHandlers->raiseValueChangeEvent();
 }
 
@@ -315,7 +315,7 @@ void CCycleButton::drawContents(CGraphicsPort *port)
 
   port->drawBitmap(rect.getX(), rect.getY() + glyphYOffset,
                    g_cycle.width, g_cycle.height, &g_cycle,
-                   0, 0, CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
+                   0, 0, CONFIG_NXWIDGETS_TRANSPARENT_COLOR, true);
 
   // Only draw text if option is selected
 
@@ -431,7 +431,7 @@ void CCycleButton::onPreRelease(nxgl_coord_t x, nxgl_coord_t y)
         }
     }
 
-  redraw();
+  invalidate();
 
   CButton::onPreRelease(x, y);
 }
@@ -445,5 +445,5 @@ void CCycleButton::onPreRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CCycleButton::onReleaseOutside(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
@@ -69,6 +69,7 @@
 #include "graphics/nxwidgets/cgraphicsport.hxx"
 #include "graphics/nxwidgets/cbitmap.hxx"
 #include "graphics/nxwidgets/singletons.hxx"
+#include "graphics/nxwidgets/cspancache.hxx"
 
 /****************************************************************************
  * Pre-Processor Definitions
@@ -123,6 +124,26 @@ CGlyphButton::CGlyphButton(CWidgetControl *pWidgetControl,
   m_bitmapClicked         = clickedGlyph;
 }
 
+/**
+ * Destructor.
+ */
+
+CGlyphButton::~CGlyphButton(void)
+{
+#ifdef CONFIG_NXWIDGETS_SPANCACHE
+  // The glyphs may be freed once the button is gone, so discard their
+  // cached spans
+
+  if (g_spanCache)
+    {
+      g_spanCache->lock();
+      g_spanCache->invalidate(m_bitmapNormal);
+      g_spanCache->invalidate(m_bitmapClicked);
+      g_spanCache->unlock();
+    }
+#endif
+}
+
 /**
  * Insert the dimensions that this widget wants to have into the rect
  * passed in as a parameter.  All coordinates are relative to the widget's
@@ -181,7 +202,7 @@ void CGlyphButton::drawContents(CGraphicsPort *port)
       port->drawBitmap(rect.getX() + m_bitmapX, rect.getY() + m_bitmapY,
                        bitmap->width, bitmap->height,
                        bitmap, 0, 0,
-                       CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
+                       CONFIG_NXWIDGETS_TRANSPARENT_COLOR, true);
     }
   else
     {
@@ -253,7 +274,7 @@ void CGlyphButton::drawOutline(CGraphicsPort *port)
 
 void CGlyphButton::onClick(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -278,7 +299,7 @@ void CGlyphButton::onPreRelease(nxgl_coord_t x, nxgl_coord_t y)
 void CGlyphButton::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 {
   m_widgetEventHandlers->raiseReleaseEvent(x, y);
-  redraw();
+  invalidate();
 }
 
 /**
@@ -290,5 +311,5 @@ void CGlyphButton::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CGlyphButton::onReleaseOutside(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
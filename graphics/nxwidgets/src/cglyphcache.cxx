@@ -0,0 +1,380 @@
+/****************************************************************************
+ * apps/graphics/nxwidgets/src/cglyphcache.cxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <semaphore.h>
+#include <cerrno>
+#include <debug.h>
+
+#include <nuttx/nx/nxglib.h>
+#include <nuttx/nx/nxfonts.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/cnxfont.hxx"
+#include "graphics/nxwidgets/cbitmap.hxx"
+#include "graphics/nxwidgets/cglyphcache.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Method Implementations
+ ****************************************************************************/
+
+using namespace NXWidgets;
+
+/**
+ * Constructor.
+ *
+ * @param nEntries The maximum number of glyphs that will be cached.
+ */
+
+CGlyphCache::CGlyphCache(uint16_t nEntries)
+{
+  m_nEntries = nEntries > 0 ? nEntries : 1;
+  m_head     = (FAR struct SGlyphEntry *)0;
+  m_tail     = (FAR struct SGlyphEntry *)0;
+  m_hits     = 0;
+  m_misses   = 0;
+
+  sem_init(&m_sem, 0, 1);
+
+  // Allocate the entry pool and the hash table
+
+  m_entries  = new struct SGlyphEntry[m_nEntries];
+  m_hash     = new FAR struct SGlyphEntry *[m_nEntries];
+
+  if (!m_entries || !m_hash)
+    {
+      gerr("ERROR: Failed to allocate the glyph cache\n");
+      m_nEntries = 0;
+      return;
+    }
+
+  // Put every (empty) entry in the LRU list
+
+  for (int i = 0; i < m_nEntries; i++)
+    {
+      FAR struct SGlyphEntry *entry = &m_entries[i];
+      entry->data      = (FAR uint8_t *)0;
+      entry->allocSize = 0;
+      entry->hnext     = (FAR struct SGlyphEntry *)0;
+      entry->valid     = false;
+
+      m_hash[i]        = (FAR struct SGlyphEntry *)0;
+
+      entry->flink     = (FAR struct SGlyphEntry *)0;
+      entry->blink     = m_tail;
+
+      if (m_tail)
+        {
+          m_tail->flink = entry;
+        }
+      else
+        {
+          m_head = entry;
+        }
+
+      m_tail = entry;
+    }
+}
+
+/**
+ * Destructor.
+ */
+
+CGlyphCache::~CGlyphCache(void)
+{
+  if (m_entries)
+    {
+      for (int i = 0; i < m_nEntries; i++)
+        {
+          if (m_entries[i].data)
+            {
+              delete[] m_entries[i].data;
+            }
+        }
+
+      delete[] m_entries;
+    }
+
+  if (m_hash)
+    {
+      delete[] m_hash;
+    }
+
+  sem_destroy(&m_sem);
+}
+
+/**
+ * Get exclusive access to the cache.
+ */
+
+void CGlyphCache::lock(void)
+{
+  while (sem_wait(&m_sem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+/**
+ * Remove an entry from the LRU list.
+ */
+
+void CGlyphCache::unlinkEntry(FAR struct SGlyphEntry *entry)
+{
+  if (entry->blink)
+    {
+      entry->blink->flink = entry->flink;
+    }
+  else
+    {
+      m_head = entry->flink;
+    }
+
+  if (entry->flink)
+    {
+      entry->flink->blink = entry->blink;
+    }
+  else
+    {
+      m_tail = entry->blink;
+    }
+
+  entry->flink = (FAR struct SGlyphEntry *)0;
+  entry->blink = (FAR struct SGlyphEntry *)0;
+}
+
+/**
+ * Add an entry at the head of the LRU list.
+ */
+
+void CGlyphCache::linkEntry(FAR struct SGlyphEntry *entry)
+{
+  entry->blink = (FAR struct SGlyphEntry *)0;
+  entry->flink = m_head;
+
+  if (m_head)
+    {
+      m_head->blink = entry;
+    }
+  else
+    {
+      m_tail = entry;
+    }
+
+  m_head = entry;
+}
+
+/**
+ * Remove an entry from its hash chain.
+ */
+
+void CGlyphCache::unhashEntry(FAR struct SGlyphEntry *entry)
+{
+  unsigned int index = hashIndex(entry->fontId, entry->letter, entry->color);
+  FAR struct SGlyphEntry **prev = &m_hash[index];
+
+  while (*prev)
+    {
+      if (*prev == entry)
+        {
+          *prev = entry->hnext;
+          break;
+        }
+
+      prev = &(*prev)->hnext;
+    }
+
+  entry->hnext = (FAR struct SGlyphEntry *)0;
+  entry->valid = false;
+}
+
+/**
+ * Return a rendered glyph, rendering it into the cache if necessary.
+ *
+ * @param font The font to render with.
+ * @param letter The character to render.
+ * @param background The background color.  Ignored if transparent is true.
+ * @param transparent True if the glyph will be merged onto existing display
+ *   content.
+ * @param bitmap The location to return the description of the glyph.
+ * @return True if the glyph is available.
+ */
+
+bool CGlyphCache::getGlyph(CNxFont *font, nxwidget_char_t letter,
+                           nxgl_mxpixel_t background, bool transparent,
+                           FAR struct SBitmap *bitmap)
+{
+  if (m_nEntries == 0)
+    {
+      return false;
+    }
+
+  enum nx_fontid_e fontId = font->getFontId();
+  nxgl_mxpixel_t color    = font->getColor();
+
+  if (transparent)
+    {
+      background = transparentBackground(color);
+    }
+
+  // Search the hash chain for the glyph
+
+  unsigned int index = hashIndex(fontId, letter, color);
+  FAR struct SGlyphEntry *entry;
+
+  for (entry = m_hash[index]; entry; entry = entry->hnext)
+    {
+      if (entry->letter == letter && entry->fontId == fontId &&
+          entry->color == color && entry->background == background &&
+          entry->bpp == CONFIG_NXWIDGETS_BPP)
+        {
+          break;
+        }
+    }
+
+  if (entry)
+    {
+      // Cache hit.  Make this the most recently used entry
+
+      m_hits++;
+      if (entry != m_head)
+        {
+          unlinkEntry(entry);
+          linkEntry(entry);
+        }
+    }
+  else
+    {
+      // Cache miss.  Re-use the least recently used entry
+
+      m_misses++;
+
+      entry = m_tail;
+      if (entry->valid)
+        {
+          unhashEntry(entry);
+        }
+
+      // Get the size of the glyph
+
+      struct nx_fontmetric_s metrics;
+      font->getCharMetrics(letter, &metrics);
+
+      nxgl_coord_t width  = (nxgl_coord_t)(metrics.width + metrics.xoffset);
+      nxgl_coord_t height = (nxgl_coord_t)font->getHeight();
+      uint16_t     stride = (width * CONFIG_NXWIDGETS_BPP + 7) >> 3;
+      uint32_t     size   = (uint32_t)stride * height;
+
+      // Make sure that the entry memory is large enough
+
+      if (size > entry->allocSize)
+        {
+          if (entry->data)
+            {
+              delete[] entry->data;
+            }
+
+          entry->data      = new uint8_t[size];
+          entry->allocSize = entry->data ? size : 0;
+
+          if (!entry->data)
+            {
+              gerr("ERROR: Failed to allocate glyph memory\n");
+              return false;
+            }
+        }
+
+      entry->width      = width;
+      entry->height     = height;
+      entry->stride     = stride;
+      entry->color      = color;
+      entry->background = background;
+      entry->fontId     = fontId;
+      entry->letter     = letter;
+      entry->bpp        = CONFIG_NXWIDGETS_BPP;
+
+      // Fill the glyph memory with the background color
+
+      FAR nxwidget_pixel_t *bmPtr = (FAR nxwidget_pixel_t *)entry->data;
+      unsigned int npixels        = (unsigned int)width * height;
+
+      for (unsigned int i = 0; i < npixels; i++)
+        {
+          *bmPtr++ = (nxwidget_pixel_t)background;
+        }
+
+      // And render the font on top of the background
+
+      struct SBitmap glyph;
+      glyph.bpp    = CONFIG_NXWIDGETS_BPP;
+      glyph.fmt    = CONFIG_NXWIDGETS_FMT;
+      glyph.width  = width;
+      glyph.height = height;
+      glyph.stride = stride;
+      glyph.data   = (FAR const void *)entry->data;
+
+      font->drawChar(&glyph, letter);
+
+      // Add the entry to its hash chain and make it the most recently used
+
+      entry->hnext  = m_hash[index];
+      m_hash[index] = entry;
+      entry->valid  = true;
+
+      unlinkEntry(entry);
+      linkEntry(entry);
+    }
+
+  // Return the glyph
+
+  bitmap->bpp    = CONFIG_NXWIDGETS_BPP;
+  bitmap->fmt    = CONFIG_NXWIDGETS_FMT;
+  bitmap->width  = entry->width;
+  bitmap->height = entry->height;
+  bitmap->stride = entry->stride;
+  bitmap->data   = (FAR const void *)entry->data;
+  return true;
+}
+
+/**
+ * Discard all cached glyphs.  The statistics are not affected.
+ */
+
+void CGlyphCache::flush(void)
+{
+  for (int i = 0; i < m_nEntries; i++)
+    {
+      m_entries[i].hnext = (FAR struct SGlyphEntry *)0;
+      m_entries[i].valid = false;
+      m_hash[i]          = (FAR struct SGlyphEntry *)0;
+    }
+}
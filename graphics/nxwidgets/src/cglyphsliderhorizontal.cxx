@@ -503,5 +503,5 @@ void CGlyphSliderHorizontal::onClick(nxgl_coord_t x, nxgl_coord_t y)
       setValueWithBitshift(m_value - (m_pageSize << 16));
     }
 
-  redraw();
+  invalidate();
 }
@@ -113,7 +113,7 @@ void CGlyphSliderHorizontalGrip::onResize(nxgl_coord_t width, nxgl_coord_t heigh
 void CGlyphSliderHorizontalGrip::onClick(nxgl_coord_t x, nxgl_coord_t y)
 {
   startDragging(x, y);
-  redraw();
+  invalidate();
 }
 
 /**
@@ -125,7 +125,7 @@ void CGlyphSliderHorizontalGrip::onClick(nxgl_coord_t x, nxgl_coord_t y)
 
 void CGlyphSliderHorizontalGrip::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -137,7 +137,7 @@ void CGlyphSliderHorizontalGrip::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CGlyphSliderHorizontalGrip::onReleaseOutside(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -182,6 +182,6 @@ void CGlyphSliderHorizontalGrip::onDrag(nxgl_coord_t x, nxgl_coord_t y,
       // Move to new location
 
       moveTo(destX, (rect.getHeight() - getHeight()) >> 1);
-      m_parent->redraw();
+      m_parent->invalidate();
     }
 }
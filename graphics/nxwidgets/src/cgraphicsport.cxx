@@ -61,6 +61,7 @@
 #include <sys/types.h>
 #include <stdint.h>
 #include <stdbool.h>
+#include <cstring>
 #include <cerrno>
 #include <debug.h>
 
@@ -76,16 +77,113 @@
 #include "graphics/nxwidgets/cwidgetstyle.hxx"
 #include "graphics/nxwidgets/cbitmap.hxx"
 #include "graphics/nxwidgets/singletons.hxx"
+#include "graphics/nxwidgets/cglyphcache.hxx"
+#include "graphics/nxwidgets/cspancache.hxx"
 
 /****************************************************************************
  * Pre-Processor Definitions
  ****************************************************************************/
 
+using namespace NXWidgets;
+
 /****************************************************************************
- * Method Implementations
+ * Private Functions
  ****************************************************************************/
 
-using namespace NXWidgets;
+/**
+ * Convert a run of pixels to greyscale.  The source and destination may be
+ * the same buffer.  The loops have no branches and no calls so that the
+ * compiler can process several pixels per instruction where the target
+ * supports it.
+ *
+ * @param dest The converted pixels.
+ * @param src The pixels to convert.
+ * @param npixels The number of pixels in the run.
+ */
+
+static void greyScaleRun(FAR uint8_t *dest, FAR const uint8_t *src,
+                         size_t npixels)
+{
+#if CONFIG_NXWIDGETS_BPP == 24
+  // Packed 24-bit pixels.  The average does not depend on the order of
+  // the color components in memory.
+
+  for (size_t i = 0; i < npixels; i++, src += 3, dest += 3)
+    {
+      uint8_t avg = (uint8_t)(((unsigned int)src[0] + src[1] + src[2]) / 3);
+      dest[0] = avg;
+      dest[1] = avg;
+      dest[2] = avg;
+    }
+#else
+  FAR const nxwidget_pixel_t *srcPtr  = (FAR const nxwidget_pixel_t *)src;
+  FAR nxwidget_pixel_t       *destPtr = (FAR nxwidget_pixel_t *)dest;
+
+  for (size_t i = 0; i < npixels; i++)
+    {
+      // Break out the individual components.  A truly accurate greyscale
+      // conversion would be complex.  Let's just average.
+
+      nxwidget_pixel_t rgb = srcPtr[i];
+      unsigned int     avg = ((unsigned int)RGB2RED(rgb) + RGB2GREEN(rgb) +
+                              RGB2BLUE(rgb)) / 3;
+      destPtr[i] = MKRGB(avg, avg, avg);
+    }
+#endif
+}
+
+/**
+ * Invert the colors of a buffer of pixels in place.
+ *
+ * @param buffer The pixels to invert.
+ * @param npixels The number of pixels in the buffer.
+ */
+
+static void invertRun(FAR uint8_t *buffer, size_t npixels)
+{
+#if CONFIG_NXWIDGETS_BPP == 32
+  // Only the low 24 bits hold color.  The unused bits are cleared.
+
+  FAR uint32_t *ptr = (FAR uint32_t *)buffer;
+  for (size_t i = 0; i < npixels; i++)
+    {
+      ptr[i] = ~ptr[i] & 0x00ffffff;
+    }
+#else
+  // Every bit of the 8-, 16- and packed 24-bit formats holds color, so
+  // inverting each component inverts every bit.  Do that a word at a time
+  // once the buffer is aligned.
+
+  size_t nbytes = (npixels * CONFIG_NXWIDGETS_BPP) >> 3;
+
+  while (nbytes > 0 && ((uintptr_t)buffer & (sizeof(uint32_t) - 1)) != 0)
+    {
+      *buffer++ ^= 0xff;
+      nbytes--;
+    }
+
+  FAR uint32_t *ptr    = (FAR uint32_t *)buffer;
+  size_t        nwords = nbytes / sizeof(uint32_t);
+
+  for (size_t i = 0; i < nwords; i++)
+    {
+      ptr[i] = ~ptr[i];
+    }
+
+  buffer += nwords * sizeof(uint32_t);
+  nbytes -= nwords * sizeof(uint32_t);
+
+  while (nbytes > 0)
+    {
+      *buffer++ ^= 0xff;
+      nbytes--;
+    }
+#endif
+}
+
+/****************************************************************************
+ * Method Implementations
+ ****************************************************************************/
 
 /**
  * Constructor.
@@ -100,11 +198,21 @@ CGraphicsPort::CGraphicsPort(INxWindow *pNxWnd, nxgl_mxpixel_t backColor)
 {
   m_pNxWnd    = pNxWnd;
   m_backColor = backColor;
+  m_clipping  = false;
+#ifdef CONFIG_NXWIDGETS_PIXELBUFFER
+  m_pixelBuffer     = (FAR uint8_t *)0;
+  m_pixelBufferSize = 0;
+#endif
 }
 #else
 CGraphicsPort::CGraphicsPort(INxWindow *pNxWnd)
 {
-  m_pNxWnd = pNxWnd;
+  m_pNxWnd   = pNxWnd;
+  m_clipping = false;
+#ifdef CONFIG_NXWIDGETS_PIXELBUFFER
+  m_pixelBuffer     = (FAR uint8_t *)0;
+  m_pixelBufferSize = 0;
+#endif
 }
 #endif
 
@@ -117,8 +225,52 @@ CGraphicsPort::~CGraphicsPort(void)
   // m_pNxWnd is not deleted.  This is an abstract base class and
   // the caller of the CGraphicsPort instance is responsible for
   // the window destruction.
+
+#ifdef CONFIG_NXWIDGETS_PIXELBUFFER
+  delete[] m_pixelBuffer;
+#endif
 };
 
+/**
+ * Get a working buffer for pixel operations.
+ *
+ * @param size The size of the buffer in bytes.
+ * @return The buffer, or NULL if it could not be allocated.  It must be
+ *   released with freePixelBuffer().
+ */
+
+FAR uint8_t *CGraphicsPort::allocPixelBuffer(size_t size)
+{
+#ifdef CONFIG_NXWIDGETS_PIXELBUFFER
+  // Keep the buffer for the next operation, growing it when needed
+
+  if (size > m_pixelBufferSize)
+    {
+      delete[] m_pixelBuffer;
+
+      m_pixelBuffer     = new uint8_t[size];
+      m_pixelBufferSize = m_pixelBuffer ? size : 0;
+    }
+
+  return m_pixelBuffer;
+#else
+  return new uint8_t[size];
+#endif
+}
+
+/**
+ * Release a working buffer returned by allocPixelBuffer().
+ *
+ * @param buffer The buffer to release.
+ */
+
+void CGraphicsPort::freePixelBuffer(FAR uint8_t *buffer)
+{
+#ifndef CONFIG_NXWIDGETS_PIXELBUFFER
+  delete[] buffer;
+#endif
+}
+
 /**
  * Return the absolute x coordinate of the upper left hand corner of the
  * underlying window.
@@ -147,6 +299,36 @@ const nxgl_coord_t CGraphicsPort::getY(void) const
   return pos.y;
 };
 
+/**
+ * Limit all subsequent drawing to a region of the window.
+ *
+ * @param rect The window-relative clipping rectangle.
+ */
+
+void CGraphicsPort::setClipRect(const CRect &rect)
+{
+  rect.getNxRect(&m_clipRect);
+  m_clipping = true;
+}
+
+/**
+ * Get the clipping rectangle.
+ *
+ * @param rect Reference to a rect to populate with the window-relative
+ *   clipping rectangle.  Unchanged if no clipping is in effect.
+ * @return True if drawing is limited to a clipping rectangle.
+ */
+
+bool CGraphicsPort::getClipRect(CRect &rect) const
+{
+  if (m_clipping)
+    {
+      rect.setNxRect(&m_clipRect);
+    }
+
+  return m_clipping;
+}
+
 /**
  * Draw a pixel into the window.
  *
@@ -161,6 +343,12 @@ void CGraphicsPort::drawPixel(nxgl_coord_t x, nxgl_coord_t y,
   struct nxgl_point_s pos;
   pos.x = x;
   pos.y = y;
+
+  if (m_clipping && !nxgl_rectinside(&m_clipRect, &pos))
+    {
+      return;
+    }
+
   m_pNxWnd->setPixel(&pos, color);
 }
 
@@ -187,7 +375,7 @@ void CGraphicsPort::drawHorizLine(nxgl_coord_t x, nxgl_coord_t y,
 
   // Draw the line
 
-  if (!m_pNxWnd->fill(&dest, color))
+  if (clipToPort(&dest) && !m_pNxWnd->fill(&dest, color))
     {
       gerr("ERROR: INxWindow::fill failed\n");
     }
@@ -217,7 +405,7 @@ void CGraphicsPort::drawVertLine(nxgl_coord_t x, nxgl_coord_t y,
 
   // Draw the line
 
-  if (!m_pNxWnd->fill(&dest, color))
+  if (clipToPort(&dest) && !m_pNxWnd->fill(&dest, color))
     {
       gerr("ERROR: INxWindow::fill failed\n");
     }
@@ -246,6 +434,65 @@ void CGraphicsPort::drawLine(nxgl_coord_t x1, nxgl_coord_t y1,
   vector.pt2.x = x2;
   vector.pt2.y = y2;
 
+  // Skip the line if it lies entirely outside of the clipping rectangle
+
+  if (m_clipping)
+    {
+      struct nxgl_rect_s bounds;
+      bounds.pt1.x = ngl_min(x1, x2) - 1;
+      bounds.pt1.y = ngl_min(y1, y2) - 1;
+      bounds.pt2.x = ngl_max(x1, x2) + 1;
+      bounds.pt2.y = ngl_max(y1, y2) + 1;
+
+      struct nxgl_rect_s clipped;
+      nxgl_rectintersect(&clipped, &bounds, &m_clipRect);
+
+      if (nxgl_nullrect(&clipped))
+        {
+          return;
+        }
+
+      // If the line is only partly inside of the clipping rectangle, split
+      // it into trapezoids as NX would and clip each of them.  A line one
+      // pixel wide has no caps.
+
+      if (!nxgl_rectinside(&m_clipRect, &bounds.pt1) ||
+          !nxgl_rectinside(&m_clipRect, &bounds.pt2))
+        {
+          struct nxgl_trapezoid_s trap[3];
+          struct nxgl_rect_s rect;
+          bool ret = true;
+
+          switch (nxgl_splitline(&vector, trap, &rect, 1))
+            {
+              case 0:
+                ret = m_pNxWnd->fillTrapezoid(&m_clipRect, &trap[0], color) &&
+                      m_pNxWnd->fillTrapezoid(&m_clipRect, &trap[1], color) &&
+                      m_pNxWnd->fillTrapezoid(&m_clipRect, &trap[2], color);
+                break;
+
+              case 1:
+                ret = m_pNxWnd->fillTrapezoid(&m_clipRect, &trap[1], color);
+                break;
+
+              case 2:
+                ret = !clipToPort(&rect) || m_pNxWnd->fill(&rect, color);
+                break;
+
+              default:
+                ret = false;
+                break;
+            }
+
+          if (!ret)
+            {
+              gerr("ERROR: Failed to draw a clipped line\n");
+            }
+
+          return;
+        }
+    }
+
   if (!m_pNxWnd->drawLine(&vector, 1, color, caps))
     {
       gerr("ERROR: INxWindow::drawLine failed\n");
@@ -271,7 +518,11 @@ void CGraphicsPort::drawFilledRect(nxgl_coord_t x, nxgl_coord_t y,
   rect.pt1.y = y;
   rect.pt2.x = x + width - 1;
   rect.pt2.y = y + height - 1;
-  m_pNxWnd->fill(&rect, color);
+
+  if (clipToPort(&rect))
+    {
+      m_pNxWnd->fill(&rect, color);
+    }
 }
 
 /**
@@ -316,6 +567,49 @@ void CGraphicsPort::drawBevelledRect(nxgl_coord_t x, nxgl_coord_t y,
   drawVertLine(x + width - 1, y + 1, height - 2, shadowColor);   // Right
 }
 
+/**
+ * Draw a filled circle at the specified position, size, and color.
+ *
+ * @param center The window-relative coordinates of the circle center.
+ * @param radius The radius of the rectangle in pixels.
+ * @param color The color of the rectangle.
+ */
+
+void CGraphicsPort::drawFilledCircle(struct nxgl_point_s *center,
+                                     nxgl_coord_t radius,
+                                     nxgl_mxpixel_t color)
+{
+  struct nxgl_rect_s bounds;
+  bounds.pt1.x = center->x - radius;
+  bounds.pt1.y = center->y - radius;
+  bounds.pt2.x = center->x + radius;
+  bounds.pt2.y = center->y + radius;
+
+  if (m_clipping &&
+      (!nxgl_rectinside(&m_clipRect, &bounds.pt1) ||
+       !nxgl_rectinside(&m_clipRect, &bounds.pt2)))
+    {
+      // Skip the circle if it lies entirely outside of the clipping
+      // rectangle.  Otherwise, fill the trapezoids that make up the circle
+      // within the clipping rectangle.
+
+      if (clipToPort(&bounds))
+        {
+          struct nxgl_trapezoid_s traps[NCIRCLE_TRAPS];
+          nxgl_circletraps(center, radius, traps);
+
+          for (int i = 0; i < NCIRCLE_TRAPS; i++)
+            {
+              m_pNxWnd->fillTrapezoid(&m_clipRect, &traps[i], color);
+            }
+        }
+    }
+  else
+    {
+      m_pNxWnd->drawFilledCircle(center, radius, color);
+    }
+}
+
 /**
  * Draw an opaque bitmap to the window.
  *
@@ -354,7 +648,11 @@ void CGraphicsPort::drawBitmap(nxgl_coord_t x, nxgl_coord_t y,
 
   // Blit the bitmap
 
-  m_pNxWnd->bitmap(&dest, (FAR const void *)bitmap->data, &origin, bitmap->stride);
+  if (clipToPort(&dest))
+    {
+      m_pNxWnd->bitmap(&dest, (FAR const void *)bitmap->data, &origin,
+                       bitmap->stride);
+    }
 }
 
 /**
@@ -371,14 +669,78 @@ void CGraphicsPort::drawBitmap(nxgl_coord_t x, nxgl_coord_t y,
  * @param bitmapY The window-relative y coordinate within the supplied bitmap to use as
  * the origin.
  * @param transparentColor The transparent color used in the bitmap.
+ * @param constant True if the bitmap is a constant image (such as a glyph)
+ *   whose memory is never modified or freed while it is in use.
  */
 
 void CGraphicsPort::drawBitmap(nxgl_coord_t x, nxgl_coord_t y,
                                nxgl_coord_t width, nxgl_coord_t height,
                                const struct SBitmap *bitmap,
                                int bitmapX, int  bitmapY,
-                               nxgl_mxpixel_t transparentColor)
+                               nxgl_mxpixel_t transparentColor,
+                               bool constant)
 {
+#ifdef CONFIG_NXWIDGETS_SPANCACHE
+  // Draw from the pre-computed opaque spans of the bitmap if they are
+  // available.  The cache is keyed by the bitmap memory, so only bitmaps
+  // whose contents cannot change are cached.
+
+  if (constant && g_spanCache)
+    {
+      FAR const struct SOpaqueSpan *spans;
+      unsigned int nSpans;
+
+      g_spanCache->lock();
+      if (g_spanCache->getSpans(bitmap, transparentColor, &spans, &nSpans))
+        {
+          // The region of the bitmap to be drawn in bitmap coordinates
+
+          struct nxgl_rect_s region;
+          region.pt1.x = bitmapX;
+          region.pt1.y = bitmapY;
+          region.pt2.x = bitmapX + width - 1;
+          region.pt2.y = bitmapY + height - 1;
+
+          // The origin of the full bitmap in window coordinates
+
+          struct nxgl_point_s origin;
+          origin.x = x - bitmapX;
+          origin.y = y - bitmapY;
+
+          for (unsigned int i = 0; i < nSpans; i++)
+            {
+              // Clip the span to the region and blit what is left
+
+              struct nxgl_rect_s span;
+              span.pt1.x = spans[i].x;
+              span.pt1.y = spans[i].y;
+              span.pt2.x = spans[i].x + spans[i].width - 1;
+              span.pt2.y = spans[i].y + spans[i].height - 1;
+
+              struct nxgl_rect_s clipped;
+              nxgl_rectintersect(&clipped, &span, &region);
+
+              if (!nxgl_nullrect(&clipped))
+                {
+                  struct nxgl_rect_s dest;
+                  nxgl_rectoffset(&dest, &clipped, origin.x, origin.y);
+
+                  if (clipToPort(&dest))
+                    {
+                      m_pNxWnd->bitmap(&dest, bitmap->data, &origin,
+                                       bitmap->stride);
+                    }
+                }
+            }
+
+          g_spanCache->unlock();
+          return;
+        }
+
+      g_spanCache->unlock();
+    }
+#endif
+
   // Get the starting position in the image, offset by bitmapX and bitmapY into the image.
 
   FAR uint8_t *srcLine = (uint8_t *)bitmap->data +
@@ -492,7 +854,11 @@ void CGraphicsPort::drawBitmap(nxgl_coord_t x, nxgl_coord_t y,
 
       // Blit the bitmap
 
-      m_pNxWnd->bitmap(&dest, (FAR const void *)runPtr, &origin, bitmap->stride);
+      if (clipToPort(&dest))
+        {
+          m_pNxWnd->bitmap(&dest, (FAR const void *)runPtr, &origin,
+                           bitmap->stride);
+        }
     }
 }
 
@@ -515,71 +881,57 @@ void CGraphicsPort::drawBitmapGreyScale(nxgl_coord_t x, nxgl_coord_t y,
                                         const struct SBitmap *bitmap,
                                         int bitmapX, int bitmapY)
 {
-  // Working buffer.  Holds one converted row from the bitmap
-
-  FAR nxwidget_pixel_t *run = new nxwidget_pixel_t[width];
-  if (!run)
-    {
-      ginfo("ERROR: Failed to allocated run buffer\n");
-      return;
-    }
-
-  // Pointer to the beginning of the first source row
-
-  FAR uint8_t *src = (FAR uint8_t *)bitmap->data + bitmapY * bitmap->stride + bitmapX;
-
-  // Setup non-changing blit parameters
-
-  struct nxgl_point_s origin;
-  origin.x   = x;
-  origin.y   = y;
+  // Limit the region to the clipping rectangle
 
   struct nxgl_rect_s dest;
   dest.pt1.x = x;
   dest.pt1.y = y;
   dest.pt2.x = x + width - 1;
-  dest.pt2.y = y;
-
-  // Convert each row to greyscale and send it to the display
+  dest.pt2.y = y + height - 1;
 
-  for (int row = 0; row < height; row++)
+  if (width <= 0 || height <= 0 || !clipToPort(&dest))
     {
-      // Convert the next row
+      return;
+    }
 
-      FAR nxwidget_pixel_t *runSrc  = (FAR nxwidget_pixel_t *)src;
-      FAR nxwidget_pixel_t *runDest = run;
+  // Only the visible part of the bitmap needs to be converted
 
-      for (int col = 0; col < width; col++)
-        {
-          // Get the next RGB pixel and break out the individual components
+  nxgl_coord_t dx = dest.pt1.x - x;
+  nxgl_coord_t dy = dest.pt1.y - y;
 
-          nxwidget_pixel_t rgb = *runSrc++;
-          nxwidget_pixel_t r   = RGB2RED(rgb);
-          nxwidget_pixel_t g   = RGB2GREEN(rgb);
-          nxwidget_pixel_t b   = RGB2BLUE(rgb);
+  width  = dest.pt2.x - dest.pt1.x + 1;
+  height = dest.pt2.y - dest.pt1.y + 1;
 
-          // A truly accurate greyscale conversion would be complex.  Let's
-          // just average.
+  // Working buffer.  Holds the converted region of the bitmap
 
-          nxwidget_pixel_t avg = (r + g + b) / 3;
-          *runDest++ = MKRGB(avg, avg, avg);
-        }
+  unsigned int stride = ((unsigned int)width * CONFIG_NXWIDGETS_BPP + 7) >> 3;
+  FAR uint8_t *buffer = allocPixelBuffer((size_t)height * stride);
+  if (!buffer)
+    {
+      ginfo("ERROR: Failed to allocate the greyscale buffer\n");
+      return;
+    }
 
-      // Now blit the single row
+  // Convert each row of the source to greyscale
 
-      m_pNxWnd->bitmap(&dest, run, &origin, bitmap->stride);
+  FAR const uint8_t *src = (FAR const uint8_t *)bitmap->data +
+                           (bitmapY + dy) * bitmap->stride +
+                           (((bitmapX + dx) * CONFIG_NXWIDGETS_BPP) >> 3);
 
-       // Setup for the next source row
+  for (int row = 0; row < height; row++)
+    {
+      greyScaleRun(&buffer[row * stride], src, width);
+      src += bitmap->stride;
+    }
 
-       y++;
-       origin.y   = y;
-       dest.pt1.y = y;
-       dest.pt2.y = y;
+  // Then send the whole region to the display at once
 
-       src += bitmap->stride;
-    }
+  struct nxgl_point_s origin;
+  origin.x = dest.pt1.x;
+  origin.y = dest.pt1.y;
 
-  delete[] run;
+  m_pNxWnd->bitmap(&dest, (FAR const void *)buffer, &origin, stride);
+  freePixelBuffer(buffer);
 }
 
 /**
@@ -594,7 +946,7 @@ void CGraphicsPort::drawBitmapGreyScale(nxgl_coord_t x, nxgl_coord_t y,
 void CGraphicsPort::drawText(struct nxgl_point_s *pos, CRect *bound,
                              CNxFont *font, const CNxString &string)
 {
-  _drawText(pos, bound, font, string, 0, string.getLength(), 0, true);
+  _drawText(pos, bound, font, string.getView(), 0, true);
 }
 
 /**
@@ -622,7 +974,8 @@ void CGraphicsPort::drawText(struct nxgl_point_s *pos, CRect *bound,
 
   // Draw the string with this new color
 
-  _drawText(pos, bound, font, string, startIndex, length, 0, true);
+  _drawText(pos, bound, font, string.subStringView(startIndex, length),
+            0, true);
 
   // Restore the font color
 
@@ -644,7 +997,8 @@ void CGraphicsPort::drawText(struct nxgl_point_s *pos, CRect *bound,
                              CNxFont *font, const CNxString &string,
                              int startIndex, int length)
 {
-  _drawText(pos, bound, font, string, startIndex, length, 0, true);
+  _drawText(pos, bound, font, string.subStringView(startIndex, length),
+            0, true);
 }
 
 /**
@@ -670,7 +1024,69 @@ void CGraphicsPort::drawText(struct nxgl_point_s *pos, CRect *bound,
   nxgl_mxpixel_t savedColor = font->getColor();
   font->setColor(color);
 
-  _drawText(pos, bound, font, string, startIndex, length, background, false);
+  _drawText(pos, bound, font, string.subStringView(startIndex, length),
+            background, false);
+
+  font->setColor(savedColor);
+}
+
+/**
+ * Draw a string view to the window.
+ *
+ * @param pos The window-relative x/y coordinate of the string.
+ * @param bound The window-relative bounds of the string.
+ * @param font The font to draw with.
+ * @param text The characters to output.
+ */
+
+void CGraphicsPort::drawText(struct nxgl_point_s *pos, CRect *bound,
+                             CNxFont *font, const CNxStringView &text)
+{
+  _drawText(pos, bound, font, text, 0, true);
+}
+
+/**
+ * Draw a string view to the window in a specific color.
+ *
+ * @param pos The window-relative x/y coordinate of the string.
+ * @param bound The window-relative bounds of the string.
+ * @param font The font to draw with.
+ * @param text The characters to output.
+ * @param color The color of the string.
+ */
+
+void CGraphicsPort::drawText(struct nxgl_point_s *pos, CRect *bound,
+                             CNxFont *font, const CNxStringView &text,
+                             nxgl_mxpixel_t color)
+{
+  nxgl_mxpixel_t savedColor = font->getColor();
+  font->setColor(color);
+
+  _drawText(pos, bound, font, text, 0, true);
+
+  font->setColor(savedColor);
+}
+
+/**
+ * Draw a string view to the window and fill the background in one go.
+ *
+ * @param pos The window-relative x/y coordinate of the string.
+ * @param bound The window-relative bounds of the string.
+ * @param font The font to draw with.
+ * @param text The characters to output.
+ * @param color Foreground color
+ * @param background Background color
+ */
+
+void CGraphicsPort::drawText(struct nxgl_point_s *pos, CRect *bound,
+                             CNxFont *font, const CNxStringView &text,
+                             nxgl_mxpixel_t color,
+                             nxgl_mxpixel_t background)
+{
+  nxgl_mxpixel_t savedColor = font->getColor();
+  font->setColor(color);
+
+  _drawText(pos, bound, font, text, background, false);
 
   font->setColor(savedColor);
 }
@@ -680,34 +1096,24 @@ void CGraphicsPort::drawText(struct nxgl_point_s *pos, CRect *bound,
  * @param pos The window-relative x/y coordinate of the string.
  * @param bound The window-relative bounds of the string.
  * @param font The font to draw with.
- * @param string The string to output.
- * @param startIndex The start index within the string from which
- * drawing will commence.
- * @param length The number of characters to draw.
+ * @param text The characters to output.
  * @param background Color to use for background if transparent is false.
  * @param transparent Whether to fill the background.
  */
 
 void CGraphicsPort::_drawText(struct nxgl_point_s *pos, CRect *bound,
-                              CNxFont *font, const CNxString &string,
-                              int startIndex, int length,
+                              CNxFont *font, const CNxStringView &text,
                               nxgl_mxpixel_t background,
                               bool transparent)
 {
-  // Verify index and length
+  // Verify length
 
-  int stringLength = string.getLength();
-  if (startIndex >= stringLength)
+  int length = text.getLength();
+  if (length <= 0)
     {
       return;
     }
 
-  int endIndex = startIndex + length;
-  if (endIndex > stringLength)
-    {
-      endIndex = stringLength;
-    }
-
 #ifdef CONFIG_NX_WRITEONLY
   if (transparent)
     {
@@ -731,6 +1137,27 @@ void CGraphicsPort::_drawText(struct nxgl_point_s *pos, CRect *bound,
   struct nxgl_rect_s boundingBox;
   bound->getNxRect(&boundingBox);
 
+  // Nothing outside of the clipping rectangle may be drawn.  An empty
+  // bounding box still advances the position past the string.
+
+  if (m_clipping)
+    {
+      nxgl_rectintersect(&boundingBox, &boundingBox, &m_clipRect);
+    }
+
+#ifdef CONFIG_NXWIDGETS_TEXTRUN
+  // Try to compose the whole string off-screen and send it in one blit.
+  // Fall back to drawing one character at a time if that is not possible.
+
+  if (glyph &&
+      _drawTextRun(pos, &boundingBox, font, text, glyph, background,
+                   transparent))
+    {
+      delete[] glyph;
+      return;
+    }
+#endif
+
   // Loop setup
 
   struct SBitmap bitmap;
@@ -740,11 +1167,12 @@ void CGraphicsPort::_drawText(struct nxgl_point_s *pos, CRect *bound,
 
   // Loop for each letter in the sub-string
 
-  for (int i = startIndex; i < endIndex; i++)
+  FAR const nxwidget_char_t *chars = text.getCharArray();
+  for (int i = 0; i < length; i++)
     {
       // Get the next letter in the string
 
-      const nxwidget_char_t letter = string.getCharAt(i);
+      const nxwidget_char_t letter = chars[i];
 
       // Get the font metrics for this letter
 
@@ -783,6 +1211,18 @@ void CGraphicsPort::_drawText(struct nxgl_point_s *pos, CRect *bound,
 
           if (!nxgl_nullrect(&intersection))
             {
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+              // Use the pre-rendered glyph if the cache can provide it
+
+              if (g_glyphCache &&
+                  _drawCachedChar(pos, &dest, &intersection, font, letter,
+                                  &bitmap, background, transparent))
+                {
+                  pos->x += fontWidth;
+                  continue;
+                }
+#endif
+
               // If we have been given a background color, use it to fill the array.
               // Otherwise initialize the bitmap memory by reading from the display.
               // The font renderer always renders the fonts on a transparent background.
@@ -827,6 +1267,307 @@ void CGraphicsPort::_drawText(struct nxgl_point_s *pos, CRect *bound,
   delete[] glyph;
 }
 
+#ifdef CONFIG_NXWIDGETS_TEXTRUN
+/**
+ * Compose the visible part of a string in an off-screen row buffer and
+ * send it to the window with a single bitmap operation.
+ *
+ * @param pos The window-relative x/y coordinate of the string.  On return,
+ *   the x coordinate is advanced past the string.
+ * @param bound The window-relative bounds of the string.
+ * @param font The font to draw with.
+ * @param text The characters to output.
+ * @param glyph Working memory large enough to hold the largest glyph.
+ * @param background Color to use for background if transparent is false.
+ * @param transparent Whether to fill the background.
+ * @return False if the row buffer could not be allocated.
+ */
+
+bool CGraphicsPort::_drawTextRun(struct nxgl_point_s *pos,
+                                 FAR const struct nxgl_rect_s *bound,
+                                 CNxFont *font, const CNxStringView &text,
+                                 FAR uint8_t *glyph,
+                                 nxgl_mxpixel_t background,
+                                 bool transparent)
+{
+  // Get the total width of the run
+
+  nxgl_coord_t runWidth = font->getStringWidth(text);
+
+  nxgl_coord_t height = (nxgl_coord_t)font->getHeight();
+
+  // Describe the bounding box of the whole run and clip it
+
+  struct nxgl_rect_s runBox;
+  runBox.pt1.x = pos->x;
+  runBox.pt1.y = pos->y;
+  runBox.pt2.x = pos->x + runWidth - 1;
+  runBox.pt2.y = pos->y + height - 1;
+
+  struct nxgl_rect_s clip;
+  nxgl_rectintersect(&clip, &runBox, bound);
+
+  if (nxgl_nullrect(&clip))
+    {
+      // Nothing is visible.  Just advance the position.
+
+      pos->x += runWidth;
+      return true;
+    }
+
+  // The row buffer spans the visible columns and all rows of the font
+
+  nxgl_coord_t firstX   = clip.pt1.x;
+  nxgl_coord_t lastX    = clip.pt2.x;
+  nxgl_coord_t bufWidth = lastX - firstX + 1;
+
+  struct SBitmap run;
+  run.bpp    = CONFIG_NXWIDGETS_BPP;
+  run.fmt    = CONFIG_NXWIDGETS_FMT;
+  run.width  = bufWidth;
+  run.height = height;
+  run.stride = (bufWidth * CONFIG_NXWIDGETS_BPP + 7) >> 3;
+
+  FAR uint8_t *runBuffer = new uint8_t[(unsigned int)run.stride * height];
+  if (!runBuffer)
+    {
+      return false;
+    }
+
+  run.data = (FAR const void *)runBuffer;
+
+  // Initialize the row buffer with either the background color or with the
+  // current contents of the display.
+
+  struct nxgl_rect_s runDest;
+  runDest.pt1.x = firstX;
+  runDest.pt1.y = pos->y;
+  runDest.pt2.x = lastX;
+  runDest.pt2.y = runBox.pt2.y;
+
+  if (transparent)
+    {
+      m_pNxWnd->getRectangle(&runDest, &run);
+    }
+  else
+    {
+      for (nxgl_coord_t row = 0; row < height; row++)
+        {
+          FAR nxwidget_pixel_t *ptr =
+            (FAR nxwidget_pixel_t *)(runBuffer + row * run.stride);
+
+          for (nxgl_coord_t col = 0; col < bufWidth; col++)
+            {
+              *ptr++ = (nxwidget_pixel_t)background;
+            }
+        }
+    }
+
+  // Glyphs are rendered on the real background when opaque.  Transparent
+  // glyphs are rendered on the complement of the font color so that the
+  // glyph pixels can be picked out.
+
+  nxwidget_pixel_t color   = (nxwidget_pixel_t)font->getColor();
+  nxgl_mxpixel_t glyphBack = transparent ?
+                             (nxgl_mxpixel_t)(nxwidget_pixel_t)~color :
+                             background;
+
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+  if (g_glyphCache)
+    {
+      g_glyphCache->lock();
+    }
+#endif
+
+  // Copy each visible glyph into the row buffer
+
+  FAR const nxwidget_char_t *chars = text.getCharArray();
+  int length = text.getLength();
+  nxgl_coord_t x = pos->x;
+
+  for (int i = 0; i < length; i++)
+    {
+      const nxwidget_char_t letter = chars[i];
+
+      struct nx_fontmetric_s metrics;
+      font->getCharMetrics(letter, &metrics);
+
+      nxgl_coord_t fontWidth = (nxgl_coord_t)(metrics.width + metrics.xoffset);
+      nxgl_coord_t glyphX    = x;
+      x += fontWidth;
+
+      // Skip glyphs with no height (the background is already in place) and
+      // glyphs that lie outside of the visible columns
+
+      if (metrics.height == 0 || glyphX > lastX || glyphX + fontWidth <= firstX)
+        {
+          continue;
+        }
+
+      // Get the rendered glyph
+
+      struct SBitmap bitmap;
+      bool haveGlyph = false;
+
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+      if (g_glyphCache)
+        {
+          haveGlyph = g_glyphCache->getGlyph(font, letter, background,
+                                             transparent, &bitmap);
+        }
+#endif
+
+      if (!haveGlyph)
+        {
+          bitmap.bpp    = CONFIG_NXWIDGETS_BPP;
+          bitmap.fmt    = CONFIG_NXWIDGETS_FMT;
+          bitmap.width  = fontWidth;
+          bitmap.height = height;
+          bitmap.stride = (fontWidth * CONFIG_NXWIDGETS_BPP + 7) >> 3;
+          bitmap.data   = (FAR const void *)glyph;
+
+          FAR nxwidget_pixel_t *bmPtr = (FAR nxwidget_pixel_t *)glyph;
+          unsigned int npixels        = (unsigned int)fontWidth * height;
+          for (unsigned int j = 0; j < npixels; j++)
+            {
+              *bmPtr++ = (nxwidget_pixel_t)glyphBack;
+            }
+
+          font->drawChar(&bitmap, letter);
+        }
+
+      // Copy the visible columns of the glyph into the row buffer
+
+      nxgl_coord_t startCol = glyphX < firstX ? firstX - glyphX : 0;
+      nxgl_coord_t endCol   = glyphX + fontWidth - 1 > lastX ?
+                              lastX - glyphX + 1 : fontWidth;
+
+      for (nxgl_coord_t row = 0; row < height; row++)
+        {
+          FAR const nxwidget_pixel_t *src =
+            (FAR const nxwidget_pixel_t *)((FAR const uint8_t *)bitmap.data +
+                                           row * bitmap.stride) + startCol;
+          FAR nxwidget_pixel_t *dest =
+            (FAR nxwidget_pixel_t *)(runBuffer + row * run.stride) +
+            (glyphX + startCol - firstX);
+
+          if (transparent)
+            {
+              for (nxgl_coord_t col = startCol; col < endCol; col++, src++, dest++)
+                {
+                  if (*src == color)
+                    {
+                      *dest = color;
+                    }
+                }
+            }
+          else
+            {
+              memcpy(dest, src, (endCol - startCol) * sizeof(nxwidget_pixel_t));
+            }
+        }
+    }
+
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+  if (g_glyphCache)
+    {
+      g_glyphCache->unlock();
+    }
+#endif
+
+  // Then put the whole run on the display
+
+  struct nxgl_point_s origin;
+  origin.x = firstX;
+  origin.y = pos->y;
+
+  if (!m_pNxWnd->bitmap(&clip, (FAR const void *)runBuffer, &origin,
+                        run.stride))
+    {
+      ginfo("nx_bitmapwindow failed: %d\n", errno);
+    }
+
+  delete[] runBuffer;
+
+  pos->x += runWidth;
+  return true;
+}
+#endif
+
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+/**
+ * Draw one character using the shared glyph cache.
+ *
+ * @param pos The window-relative x/y coordinate of the character.
+ * @param dest The window-relative bounding box of the character.
+ * @param clip The part of dest that is to be drawn.
+ * @param font The font to draw with.
+ * @param letter The character to draw.
+ * @param bitmap Working memory large enough to hold the character.
+ * @param background Color to use for background if transparent is false.
+ * @param transparent Whether to fill the background.
+ * @return False if the glyph cache could not provide the character.
+ */
+
+bool CGraphicsPort::_drawCachedChar(FAR const struct nxgl_point_s *pos,
+                                    FAR const struct nxgl_rect_s *dest,
+                                    FAR const struct nxgl_rect_s *clip,
+                                    CNxFont *font, nxwidget_char_t letter,
+                                    FAR struct SBitmap *bitmap,
+                                    nxgl_mxpixel_t background,
+                                    bool transparent)
+{
+  g_glyphCache->lock();
+
+  struct SBitmap glyph;
+  if (!g_glyphCache->getGlyph(font, letter, background, transparent, &glyph))
+    {
+      g_glyphCache->unlock();
+      return false;
+    }
+
+  bool ret;
+  if (transparent)
+    {
+      // Read the current contents of the destination and merge the glyph
+      // pixels (those that have the font color) on top of it.
+
+      m_pNxWnd->getRectangle(dest, bitmap);
+
+      FAR const nxwidget_pixel_t *src = (FAR const nxwidget_pixel_t *)glyph.data;
+      FAR nxwidget_pixel_t *dst       = (FAR nxwidget_pixel_t *)bitmap->data;
+      nxwidget_pixel_t color          = (nxwidget_pixel_t)font->getColor();
+      unsigned int npixels            = (unsigned int)glyph.width * glyph.height;
+
+      for (unsigned int i = 0; i < npixels; i++)
+        {
+          if (src[i] == color)
+            {
+              dst[i] = color;
+            }
+        }
+
+      g_glyphCache->unlock();
+
+      ret = m_pNxWnd->bitmap(clip, bitmap->data, pos, bitmap->stride);
+    }
+  else
+    {
+      // The cached glyph already has the background color
+
+      ret = m_pNxWnd->bitmap(clip, glyph.data, pos, glyph.stride);
+      g_glyphCache->unlock();
+    }
+
+  if (!ret)
+    {
+      ginfo("nx_bitmapwindow failed: %d\n", errno);
+    }
+
+  return true;
+}
+#endif
+
 /**
  * Copy a rectangular region from the source coordinates to the
  * destination coordinates.
@@ -897,79 +1638,23 @@ void CGraphicsPort::move(nxgl_coord_t x, nxgl_coord_t y,
 void CGraphicsPort::greyScale(nxgl_coord_t x, nxgl_coord_t y,
                               nxgl_coord_t width, nxgl_coord_t height)
 {
-  // Allocate memory to hold one row of graphics data
-
-  unsigned int stride    = ((unsigned int)width * CONFIG_NXWIDGETS_BPP + 7) >> 3;
-  FAR uint8_t *rowBuffer = new uint8_t[height * stride];
-  if (!rowBuffer)
-    {
-      return;
-    }
-
-  // Describe the receiving bitmap memory
-
-  SBitmap rowBitmap;
-  rowBitmap.bpp    = CONFIG_NXWIDGETS_BPP;
-  rowBitmap.fmt    = CONFIG_NXWIDGETS_FMT;
-  rowBitmap.width  = width;
-  rowBitmap.height = 1;
-  rowBitmap.stride = stride;
-  rowBitmap.data   = (FAR const nxgl_mxpixel_t *)rowBuffer;
-
-  // Partially describe the source rectangle
+  // Read the region, convert it in place and write it back
 
   struct nxgl_rect_s rect;
-  rect.pt1.x = x;
-  rect.pt2.x = x + width - 1;
-
-  // Partially setup the graphics origin
-
-  struct nxgl_point_s origin;
-  origin.x = x;
-
-  // Loop for each row in the region to be inverted
-
-  for (int row = 0; row < height; row++)
+  unsigned int stride;
+  FAR uint8_t *buffer = readRegion(x, y, width, height, &rect, &stride);
+  if (buffer)
     {
-      // Read the graphic memory corresponding to the row
-
-      rect.pt1.y = rect.pt2.y = y + row;
-      m_pNxWnd->getRectangle(&rect, &rowBitmap);
-
-      // Convert each bit to  each bit
-
-      nxwidget_pixel_t *ptr = (nxwidget_pixel_t *)rowBuffer;
-      for (int col = 0; col < width; col++)
-        {
-          // Get the next RGB pixel and break out the individual components
-
-          nxwidget_pixel_t color = *ptr;
-          uint8_t red   = RGB2RED(color);
-          uint8_t green = RGB2GREEN(color);
-          uint8_t blue  = RGB2BLUE(color);
+      width  = rect.pt2.x - rect.pt1.x + 1;
+      height = rect.pt2.y - rect.pt1.y + 1;
 
-          // A truly accurate greyscale conversion would be complex.  Let's
-          // just average.
-
-          nxwidget_pixel_t avg = (red + green + blue) / 3;
-          *ptr++ = MKRGB(avg, avg, avg);
-        }
-
-      // Then write the row back to graphics memory
-
-      origin.y = rect.pt1.y;
-      m_pNxWnd->bitmap(&rect, (FAR const void *)rowBitmap.data,
-                       &origin, rowBitmap.stride) ;
+      greyScaleRun(buffer, buffer, (size_t)width * height);
+      writeRegion(&rect, buffer, stride);
     }
-
-  delete[] rowBuffer;
 }
 
 /**
- * Invert colors in a region.  NOTE:  This allocates an in-memory
- * buffer the size of one row in graphic memory.  So it may only be
- * useful for inverting small regions and its only current use is for
- * the inverted cursor text.
+ * Invert colors in a region.
  *
  * @param x X coordinate of the region to change.
  * @param y Y coordinate of the region to change.
@@ -980,63 +1665,95 @@ void CGraphicsPort::greyScale(nxgl_coord_t x, nxgl_coord_t y,
 void CGraphicsPort::invert(nxgl_coord_t x, nxgl_coord_t y,
                            nxgl_coord_t width, nxgl_coord_t height)
 {
-  // Allocate memory to hold one row of graphics data
+  // Read the region, invert it in place and write it back
 
-  unsigned int stride    = ((unsigned int)width * CONFIG_NXWIDGETS_BPP + 7) >> 3;
-  FAR uint8_t *rowBuffer = new uint8_t[height * stride];
-  if (!rowBuffer)
+  struct nxgl_rect_s rect;
+  unsigned int stride;
+  FAR uint8_t *buffer = readRegion(x, y, width, height, &rect, &stride);
+  if (buffer)
     {
-      return;
-    }
+      width  = rect.pt2.x - rect.pt1.x + 1;
+      height = rect.pt2.y - rect.pt1.y + 1;
 
-  // Describe the receiving bitmap memory
+      invertRun(buffer, (size_t)width * height);
+      writeRegion(&rect, buffer, stride);
+    }
+}
 
-  SBitmap rowBitmap;
-  rowBitmap.bpp    = CONFIG_NXWIDGETS_BPP;
-  rowBitmap.fmt    = CONFIG_NXWIDGETS_FMT;
-  rowBitmap.width  = width;
-  rowBitmap.height = 1;
-  rowBitmap.stride = stride;
-  rowBitmap.data   = (FAR const nxgl_mxpixel_t *)rowBuffer;
+/**
+ * Read a region of the window into a working buffer with a single
+ * request.  The region is limited to the clipping rectangle.
+ *
+ * @param x X coordinate of the region.
+ * @param y Y coordinate of the region.
+ * @param width Width of the region.
+ * @param height Height of the region.
+ * @param rect Receives the window-relative region that was read.
+ * @param stride Receives the length of a row of the buffer in bytes.
+ * @return The buffer, or NULL if nothing is visible or the buffer could
+ *   not be allocated.  The buffer must be passed to writeRegion().
+ */
 
-  // Partially describe the source rectangle
+FAR uint8_t *CGraphicsPort::readRegion(nxgl_coord_t x, nxgl_coord_t y,
+                                       nxgl_coord_t width,
+                                       nxgl_coord_t height,
+                                       FAR struct nxgl_rect_s *rect,
+                                       FAR unsigned int *stride)
+{
+  // Limit the region to the clipping rectangle
 
-  struct nxgl_rect_s rect;
-  rect.pt1.x = x;
-  rect.pt2.x = x + width - 1;
+  rect->pt1.x = x;
+  rect->pt1.y = y;
+  rect->pt2.x = x + width - 1;
+  rect->pt2.y = y + height - 1;
 
-  // Partially setup the graphics origin
+  if (width <= 0 || height <= 0 || !clipToPort(rect))
+    {
+      return (FAR uint8_t *)0;
+    }
 
-  struct nxgl_point_s origin;
-  origin.x = x;
+  width   = rect->pt2.x - rect->pt1.x + 1;
+  height  = rect->pt2.y - rect->pt1.y + 1;
+  *stride = ((unsigned int)width * CONFIG_NXWIDGETS_BPP + 7) >> 3;
 
-  // Loop for each row in the region to be inverted
+  // Allocate memory to hold the whole region
 
-  for (int row = 0; row < height; row++)
+  FAR uint8_t *buffer = allocPixelBuffer((size_t)height * *stride);
+  if (!buffer)
     {
-      // Read the graphic memory corresponding to the row
+      return (FAR uint8_t *)0;
+    }
 
-      rect.pt1.y = rect.pt2.y = y + row;
-      m_pNxWnd->getRectangle(&rect, &rowBitmap);
+  // Describe the receiving bitmap memory and read the region
 
-      // Invert each bit
+  SBitmap bitmap;
+  bitmap.bpp    = CONFIG_NXWIDGETS_BPP;
+  bitmap.fmt    = CONFIG_NXWIDGETS_FMT;
+  bitmap.width  = width;
+  bitmap.height = height;
+  bitmap.stride = *stride;
+  bitmap.data   = (FAR const nxgl_mxpixel_t *)buffer;
 
-      nxwidget_pixel_t *ptr = (nxwidget_pixel_t *)rowBuffer;
-      for (int col = 0; col < width; col++)
-        {
-          nxwidget_pixel_t color = *ptr;
-          uint8_t red   = RGB2RED(color);
-          uint8_t green = RGB2GREEN(color);
-          uint8_t blue  = RGB2BLUE(color);
-          *ptr++ = MKRGB(~red, ~green, ~blue);
-        }
+  m_pNxWnd->getRectangle(rect, &bitmap);
+  return buffer;
+}
 
-      // Then write the row back to graphics memory
+/**
+ * Write a region read by readRegion() back to the window with a single
+ * request and release the working buffer.
+ *
+ * @param rect The window-relative region returned by readRegion().
+ * @param buffer The buffer returned by readRegion().
+ * @param stride The length of a row of the buffer in bytes.
+ */
 
-      origin.y = rect.pt1.y;
-      m_pNxWnd->bitmap(&rect, (FAR const void *)rowBitmap.data,
-                       &origin, rowBitmap.stride) ;
-    }
+void CGraphicsPort::writeRegion(FAR const struct nxgl_rect_s *rect,
+                                FAR uint8_t *buffer, unsigned int stride)
+{
+  struct nxgl_point_s origin;
+  origin.x = rect->pt1.x;
+  origin.y = rect->pt1.y;
 
-  delete[] rowBuffer;
-};
+  m_pNxWnd->bitmap(rect, (FAR const void *)buffer, &origin, stride);
+  freePixelBuffer(buffer);
+}
@@ -74,11 +74,61 @@
  * Pre-Processor Definitions
  ****************************************************************************/
 
+using namespace NXWidgets;
+
 /****************************************************************************
- * Method Implementations
+ * Private Functions
  ****************************************************************************/
 
-using namespace NXWidgets;
+/**
+ * Prepare a run of image pixels for the opaque drawBitmap() function.
+ *
+ * @param ptr The run of pixels to convert in place.
+ * @param npixels The number of pixels in the run.
+ * @param backColor The widget background color.
+ * @param greyScale True if the image is disabled and drawn in grey scale.
+ */
+
+static void convertRun(FAR nxwidget_pixel_t *ptr, int npixels,
+                       nxwidget_pixel_t backColor, bool greyScale)
+{
+  for (int i = 0; i < npixels; i++, ptr++)
+    {
+      // Replace any transparent pixels with the background color.
+
+      if (*ptr == CONFIG_NXWIDGETS_TRANSPARENT_COLOR)
+        {
+          *ptr = backColor;
+        }
+
+      // Convert pixels (other than the background color) to grey
+      // scale if the image is disabled.  We can't use
+      // CGraphicsPort::drawBitmapGreyColor because it does not
+      // (yet) understand transparent pixels and has no idea what it
+      // should do with background colors.
+
+      else if (greyScale && *ptr != backColor)
+        {
+          // Get the next RGB pixel and break out the individual
+          // components
+
+          nxwidget_pixel_t rgb = *ptr;
+          nxwidget_pixel_t r   = RGB2RED(rgb);
+          nxwidget_pixel_t g   = RGB2GREEN(rgb);
+          nxwidget_pixel_t b   = RGB2BLUE(rgb);
+
+          // A truly accurate greyscale conversion would be complex.
+          // Let's just average.
+
+          nxwidget_pixel_t avg = (r + g + b) / 3;
+          *ptr = MKRGB(avg, avg, avg);
+        }
+    }
+}
+
+/****************************************************************************
+ * Method Implementations
+ ****************************************************************************/
 
 /**
  * Constructor for a label containing a string.
@@ -111,6 +161,15 @@ CImage::CImage(CWidgetControl *pWidgetControl, nxgl_coord_t x, nxgl_coord_t y,
 
   m_origin.x    = 0;
   m_origin.y    = 0;
+
+#ifdef CONFIG_NXWIDGETS_IMAGECACHE
+  // Nothing has been converted yet
+
+  m_cache       = (FAR nxwidget_pixel_t *)0;
+  m_cacheBitmap = (FAR IBitmap *)0;
+  m_cacheWidth  = 0;
+  m_cacheHeight = 0;
+#endif
 }
 
 /**
@@ -171,6 +230,15 @@ void CImage::drawContents(CGraphicsPort *port, bool selected)
   CRect rect;
   getRect(rect);
 
+#ifdef CONFIG_NXWIDGETS_IMAGECACHE
+  // Draw the whole image at once from the cache if possible
+
+  if (drawCachedContents(port, rect, selected))
+    {
+      return;
+    }
+#endif
+
   // Allocate a working buffer that will hold one row of the bitmap
 
   FAR nxwidget_pixel_t *buffer = new nxwidget_pixel_t[rect.getWidth()];
@@ -246,8 +314,18 @@ void CImage::drawContents(CGraphicsPort *port, bool selected)
 
       nxgl_coord_t lastTopRow = nTopRows + destRow;
 
+      // Rows outside of the clipping rectangle do not need to be read
+
+      CRect clip;
+      bool clipping = port->getClipRect(clip);
+
       for (int srcRow = 0; destRow < lastTopRow; srcRow++, destRow++)
         {
+          if (clipping && (destRow < clip.getY() || destRow > clip.getY2()))
+            {
+              continue;
+            }
+
           // Read the graphics data for the left hand side of this row and
           // place it in the row buffer at offset origin.x.
 
@@ -261,39 +339,8 @@ void CImage::drawContents(CGraphicsPort *port, bool selected)
           // Pre-process special pixel values... Then we can use the faster
           // opaque drawBitmap() function.
 
-          ptr = &buffer[m_origin.x];
-          for (int i = 0; i < nLeftPixels; i++, ptr++)
-            {
-              // Replace any transparent pixels with the background color.
-
-              if (*ptr == CONFIG_NXWIDGETS_TRANSPARENT_COLOR)
-                {
-                  *ptr = backColor;
-                }
-
-              // Convert pixels (other than the background color) to grey
-              // scale if the image is disabled.  We can't use
-              // CGraphicsPort::drawBitmapGreyColor because it does not
-              // (yet) understand transparent pixels and has no idea what it
-              // should do with background colors.
-
-              else if (*ptr != backColor && !isEnabled())
-                {
-                  // Get the next RGB pixel and break out the individual
-                  // components
-
-                  nxwidget_pixel_t rgb = *ptr;
-                  nxwidget_pixel_t r   = RGB2RED(rgb);
-                  nxwidget_pixel_t g   = RGB2GREEN(rgb);
-                  nxwidget_pixel_t b   = RGB2BLUE(rgb);
-
-                  // A truly accurate greyscale conversion would be complex.
-                  // Let's just average.
-
-                  nxwidget_pixel_t avg = (r + g + b) / 3;
-                  *ptr = MKRGB(avg, avg, avg);
-                }
-            }
+          convertRun(&buffer[m_origin.x], nLeftPixels, backColor,
+                     !isEnabled());
 
           // And put these on the display
 
@@ -316,7 +363,7 @@ void CImage::drawContents(CGraphicsPort *port, bool selected)
 
       // Now draw the rows from the offset position
 
-      for (; destRow < rect.getHeight(); destRow++)
+      for (; destRow < rect.getY() + rect.getHeight(); destRow++)
         {
           // Put the padded row on the display (never greyscale)
 
@@ -328,6 +375,123 @@ void CImage::drawContents(CGraphicsPort *port, bool selected)
    delete[] buffer;
 }
 
+#ifdef CONFIG_NXWIDGETS_IMAGECACHE
+/**
+ * Draw the widget contents from the cached, converted image.  The cache
+ * is rebuilt first if the bitmap, the image position, the widget size or
+ * the state have changed since it was built.
+ *
+ * @param port The CGraphicsPort to draw to.
+ * @param rect The drawable region of the widget.
+ * @param selected True if the image is drawn selected.
+ * @return False if the cache could not be built.
+ */
+
+bool CImage::drawCachedContents(CGraphicsPort *port, const CRect &rect,
+                                bool selected)
+{
+  nxgl_coord_t     width     = rect.getWidth();
+  nxgl_coord_t     height    = rect.getHeight();
+  nxwidget_pixel_t backColor = getBackgroundColor();
+  bool             enabled   = isEnabled();
+
+  selected = selected || m_highlighted;
+
+  if (width <= 0 || height <= 0)
+    {
+      return true;
+    }
+
+  // Is the cached image still good?
+
+  if (m_cacheBitmap != m_bitmap || m_cacheOrigin.x != m_origin.x ||
+      m_cacheOrigin.y != m_origin.y || m_cacheWidth != width ||
+      m_cacheHeight != height || m_cacheBackColor != backColor ||
+      m_cacheSelected != selected || m_cacheEnabled != enabled)
+    {
+      // No.. The cache is not valid until it has been rebuilt completely.
+      // If the rebuild fails part way, the next redraw must not mistake
+      // the partly overwritten cache for the old image.
+
+      m_cacheBitmap = (FAR IBitmap *)0;
+
+      // (Re-)allocate the cache if the size has changed
+
+      if (!m_cache || m_cacheWidth != width || m_cacheHeight != height)
+        {
+          delete[] m_cache;
+          m_cacheWidth  = width;
+          m_cacheHeight = height;
+          m_cache       = new nxwidget_pixel_t[(size_t)width * height];
+
+          if (!m_cache)
+            {
+              return false;
+            }
+        }
+
+      // Start with the background color everywhere
+
+      FAR nxwidget_pixel_t *ptr    = m_cache;
+      FAR nxwidget_pixel_t *endPtr = m_cache + (size_t)width * height;
+
+      while (ptr < endPtr)
+        {
+          *ptr++ = backColor;
+        }
+
+      // Then convert the visible part of the bitmap, one row at a time
+
+      m_bitmap->setSelected(selected);
+
+      nxgl_coord_t nRows = m_bitmap->getHeight();
+      if (nRows > height - m_origin.y)
+        {
+          nRows = height - m_origin.y;
+        }
+
+      nxgl_coord_t nPixels = m_bitmap->getWidth();
+      if (nPixels > width - m_origin.x)
+        {
+          nPixels = width - m_origin.x;
+        }
+
+      for (int srcRow = 0; srcRow < nRows && nPixels > 0; srcRow++)
+        {
+          ptr = &m_cache[(size_t)(srcRow + m_origin.y) * width + m_origin.x];
+          if (!m_bitmap->getRun(0, srcRow, nPixels, ptr))
+            {
+              ginfo("IBitmap::getRun failed at image row %d\n", srcRow);
+              return false;
+            }
+
+          convertRun(ptr, nPixels, backColor, !enabled);
+        }
+
+      // Only now does the cache describe the image
+
+      m_cacheBitmap    = m_bitmap;
+      m_cacheOrigin    = m_origin;
+      m_cacheBackColor = backColor;
+      m_cacheSelected  = selected;
+      m_cacheEnabled   = enabled;
+    }
+
+  // Put the whole image on the display with a single blit
+
+  struct SBitmap bitmap;
+  bitmap.bpp    = CONFIG_NXWIDGETS_BPP;
+  bitmap.fmt    = CONFIG_NXWIDGETS_FMT;
+  bitmap.width  = width;
+  bitmap.height = height;
+  bitmap.stride = width * sizeof(nxwidget_pixel_t);
+  bitmap.data   = m_cache;
+
+  port->drawBitmap(rect.getX(), rect.getY(), width, height, &bitmap, 0, 0);
+  return true;
+}
+#endif
+
 /**
  * Draw the area of this widget that falls within the clipping region.
  * Called by the redraw() function to draw all visible regions.
@@ -405,7 +569,7 @@ void CImage::highlight(bool highlightOn)
   if (m_highlighted != highlightOn)
     {
       m_highlighted = highlightOn;
-      redraw();
+      invalidate();
     }
 }
 
@@ -418,7 +582,7 @@ void CImage::highlight(bool highlightOn)
 
 void CImage::onClick(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -442,7 +606,7 @@ void CImage::onPreRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CImage::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -454,7 +618,7 @@ void CImage::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CImage::onReleaseOutside(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
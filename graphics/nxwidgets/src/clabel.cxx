@@ -131,7 +131,7 @@ void CLabel::setTextAlignmentHoriz(TextAlignmentHoriz alignment)
 {
   m_hAlignment = alignment;
   calculateTextPositionHorizontal();
-  redraw();
+  invalidate();
 }
 
 /**
@@ -144,7 +144,7 @@ void CLabel::setTextAlignmentVert(TextAlignmentVert alignment)
 {
   m_vAlignment = alignment;
   calculateTextPositionVertical();
-  redraw();
+  invalidate();
 }
 
 /**
@@ -196,7 +196,7 @@ void CLabel::highlight(bool highlightOn)
   if (highlightOn != m_highlighted)
     {
       m_highlighted = highlightOn;
-      redraw();
+      invalidate();
     }
 }
 
@@ -249,7 +249,7 @@ void CLabel::setFont(CNxFont *font)
 
   calculateTextPositionHorizontal();
   calculateTextPositionVertical();
-  redraw();
+  invalidate();
 }
 
 /**
@@ -435,7 +435,7 @@ void CLabel::onTextChange(void)
   calculateTextPositionHorizontal();
   calculateTextPositionVertical();
   m_textChange = true;
-  redraw();
+  invalidate();
   m_textChange = false;
   m_widgetEventHandlers->raiseValueChangeEvent();
 }
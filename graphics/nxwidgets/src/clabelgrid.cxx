@@ -193,7 +193,7 @@ void CLabelGrid::onResize(nxgl_coord_t width, nxgl_coord_t height)
     }
 
   this->enableDrawing();
-  redraw();
+  invalidate();
 }
 
 void CLabelGrid::setColumnWidth(int col, int width)
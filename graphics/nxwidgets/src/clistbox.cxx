@@ -243,6 +243,17 @@ const int CListBox::getSelectedIndex(void) const
   return m_options.getSelectedIndex();
 }
 
+/**
+ * Get the number of selected options.
+ *
+ * @return The number of selected options.
+ */
+
+const int CListBox::getSelectedCount(void) const
+{
+  return m_options.getSelectedCount();
+}
+
 /**
  * Sets the selected index.  Specify -1 to select nothing.  Resets any
  * other selected options to deselected. Redraws the widget and raises
@@ -329,7 +340,22 @@ void CListBox::handleListDataChangedEvent(const CListDataEventArgs &e)
 
   m_lastSelectedIndex = -1;
   resizeCanvas();
-  redraw();
+
+  // Options above an added or removed option do not move, so there is
+  // nothing to redraw if the change is below the visible part of the list
+
+  if (e.getIndex() >= 0)
+    {
+      CRect rect;
+      getRect(rect);
+
+      if (getOptionY(e.getIndex()) >= rect.getHeight())
+        {
+          return;
+        }
+    }
+
+  invalidate();
 }
 
 /**
@@ -340,7 +366,25 @@ void CListBox::handleListDataChangedEvent(const CListDataEventArgs &e)
 
 void CListBox::handleListDataSelectionChangedEvent(const CListDataEventArgs &e)
 {
-  redraw();
+  // Only redraw if the changed option is visible
+
+  bool visible = true;
+
+  if (e.getIndex() >= 0)
+    {
+      CRect rect;
+      getRect(rect);
+
+      int32_t optionY = getOptionY(e.getIndex());
+      visible = optionY + getOptionHeight() > 0 &&
+                optionY < rect.getHeight();
+    }
+
+  if (visible)
+    {
+      invalidate();
+    }
+
   m_widgetEventHandlers->raiseValueChangeEvent();
 }
 
@@ -441,26 +485,37 @@ void CListBox::drawContents(CGraphicsPort *port)
                        rect.getWidth(), rect.getHeight(),
                        getBackgroundColor());
 
-  // Calculate clipping values
-
-  nxgl_coord_t clipX      = rect.getX();
-  nxgl_coord_t clipY      = rect.getY();
-  nxgl_coord_t clipHeight = rect.getHeight();
-
   // Precalculate values for option draw loop
 
   nxgl_coord_t optionHeight = getOptionHeight();
 
-  // Ensure that we subtract 1 from topOption to ensure that the option
-  // above is drawn if it is partially visible
+  // Only draw the options that intersect both the client area and the
+  // graphics port's clipping rectangle
 
-  int topOption = ((clipY - m_canvasY) / optionHeight) - 1;
+  int32_t top    = rect.getY();
+  int32_t bottom = rect.getY() + rect.getHeight();
 
-  // Ensure that we add 2 to the bottom option to ensure that the option
-  // below is draw if it is partially visible - subbing 1 from topOption
-  // means we need to add an additional 1 to compensate
+  CRect clip;
+  if (port->getClipRect(clip))
+    {
+      if (clip.getY() > top)
+        {
+          top = clip.getY();
+        }
 
-  int bottomOption = topOption + (clipHeight / optionHeight) + 2;
+      if (clip.getY() + clip.getHeight() < bottom)
+        {
+          bottom = clip.getY() + clip.getHeight();
+        }
+
+      if (bottom <= top)
+        {
+          return;
+        }
+    }
+
+  int topOption    = (top - rect.getY() - m_canvasY) / optionHeight;
+  int bottomOption = (bottom - 1 - rect.getY() - m_canvasY) / optionHeight;
 
   // Ensure top options is not negative
 
@@ -489,6 +544,13 @@ void CListBox::drawContents(CGraphicsPort *port)
     {
       item = (const CListBoxDataItem*)m_options.getItem(i);
 
+      // Keep the background of partially visible options inside the
+      // client area
+
+      CRect optionRect(rect.getX(), rect.getY() + y,
+                       rect.getWidth(), optionHeight);
+      optionRect.clipToIntersect(rect);
+
       // Is the option selected?
 
       if (item->isSelected())
@@ -497,8 +559,9 @@ void CListBox::drawContents(CGraphicsPort *port)
 
           if (item->getSelectedBackColor() != getBackgroundColor())
             {
-              port->drawFilledRect(rect.getX(), rect.getY() + y,
-                                   rect.getWidth(), optionHeight,
+              port->drawFilledRect(optionRect.getX(), optionRect.getY(),
+                                   optionRect.getWidth(),
+                                   optionRect.getHeight(),
                                    item->getSelectedBackColor());
             }
 
@@ -527,7 +590,9 @@ void CListBox::drawContents(CGraphicsPort *port)
 
           if (item->getNormalBackColor() != getBackgroundColor())
             {
-              port->drawFilledRect(clipX, y, getWidth(), optionHeight,
+              port->drawFilledRect(optionRect.getX(), optionRect.getY(),
+                                   optionRect.getWidth(),
+                                   optionRect.getHeight(),
                                    item->getNormalBackColor());
             }
 
@@ -83,6 +83,8 @@ CListData::CListData(void)
 {
   m_allowMultipleSelections = true;
   m_sortInsertedItems      = false;
+  m_selectedCount          = 0;
+  m_firstSelected          = -1;
 }
 
 /**
@@ -119,20 +121,41 @@ void CListData::addItem(CListDataItem *item)
 {
   // Determine insert type
 
+  int index;
+
   if (m_sortInsertedItems)
     {
       // Sorted insert
 
-      m_items.insert(getSortedInsertionIndex(item), item);
+      index = getSortedInsertionIndex(item);
+      m_items.insert(index, item);
     }
   else
     {
       // Append
 
+      index = m_items.size();
       m_items.push_back(item);
     }
 
-  raiseDataChangedEvent();
+  // Items after the new one have moved down
+
+  if (m_firstSelected >= index)
+    {
+      m_firstSelected++;
+    }
+
+  if (item->isSelected())
+    {
+      m_selectedCount++;
+
+      if (m_firstSelected < 0 || index < m_firstSelected)
+        {
+          m_firstSelected = index;
+        }
+    }
+
+  raiseDataChangedEvent(index);
 }
 
 /**
@@ -147,6 +170,11 @@ void CListData::removeItem(const int index)
 
   if (index < m_items.size())
     {
+      if (m_items[index]->isSelected())
+        {
+          m_selectedCount--;
+        }
+
       // Delete the option
 
       delete m_items[index];
@@ -154,7 +182,19 @@ void CListData::removeItem(const int index)
       // Erase the option from the list
 
       m_items.erase(index);
-      raiseDataChangedEvent();
+
+      // Items after the removed one have moved up
+
+      if (m_firstSelected > index)
+        {
+          m_firstSelected--;
+        }
+      else if (m_firstSelected == index)
+        {
+          m_firstSelected = findSelectedItem(index);
+        }
+
+      raiseDataChangedEvent(index);
     }
 }
 
@@ -194,6 +234,8 @@ void CListData::removeAllItems(void)
     }
 
   m_items.clear();
+  m_selectedCount = 0;
+  m_firstSelected = -1;
   raiseDataChangedEvent();
 }
 
@@ -206,17 +248,7 @@ void CListData::removeAllItems(void)
 
 const int CListData::getSelectedIndex(void) const
 {
-  // Get the first selected index
-
-  for (int i = 0; i < m_items.size(); i++)
-    {
-      if (m_items[i]->isSelected())
-        {
-          return i;
-        }
-    }
-
-  return -1;
+  return m_firstSelected;
 }
 
 /**
@@ -256,6 +288,7 @@ const CListDataItem *CListData::getSelectedItem(void) const
 void CListData::sort(void)
 {
   quickSort(0, m_items.size() - 1);
+  m_firstSelected = findSelectedItem(0);
   raiseDataChangedEvent();
 }
 
@@ -273,6 +306,8 @@ void CListData::selectAllItems(void)
           m_items[i]->setSelected(true);
         }
 
+      m_selectedCount = m_items.size();
+      m_firstSelected = m_selectedCount > 0 ? 0 : -1;
       raiseSelectionChangedEvent();
     }
 }
@@ -283,9 +318,12 @@ void CListData::selectAllItems(void)
 
 void CListData::deselectAllItems(void)
 {
-  for (int i = 0; i < m_items.size(); i++)
+  // Only the items from the first selected item onwards need to be visited
+
+  for (int i = m_firstSelected; i >= 0 && i < m_items.size() &&
+       m_selectedCount > 0; i++)
     {
-      m_items[i]->setSelected(false);
+      setSelectionState(i, false);
     }
 
   raiseSelectionChangedEvent();
@@ -301,14 +339,32 @@ void CListData::deselectAllItems(void)
 
 void CListData::setItemSelected(const int index, bool selected)
 {
+  // Only report the index if no other item changes
+
+  int changed = index;
+
   // Deselect old options if we're making an option selected and
-  // we're not a multiple list
+  // we're not a multiple list.  Only the items from the first selected
+  // item onwards need to be visited.
 
   if (((!m_allowMultipleSelections) || (index == -1)) && (selected))
     {
-      for (int i = 0; i < m_items.size(); i++)
+      for (int i = m_firstSelected; i >= 0 && i < m_items.size() &&
+           m_selectedCount > 0; i++)
         {
-          m_items[i]->setSelected(false);
+          if (i != index && m_items[i]->isSelected())
+            {
+              setSelectionState(i, false);
+              changed = -1;
+            }
+
+          // Stop once only the new option could remain selected
+
+          if (m_selectedCount == 1 && index > -1 &&
+              index < m_items.size() && m_items[index]->isSelected())
+            {
+              break;
+            }
         }
     }
 
@@ -316,10 +372,10 @@ void CListData::setItemSelected(const int index, bool selected)
 
   if ((index > -1) && (index < m_items.size()))
     {
-      m_items[index]->setSelected(selected);
+      setSelectionState(index, selected);
     }
 
-  raiseSelectionChangedEvent();
+  raiseSelectionChangedEvent(changed);
 }
 
 /**
@@ -407,24 +463,100 @@ void CListData::swapItems(const int index1, const int index2)
 
 const int CListData::getSortedInsertionIndex(const CListDataItem *item) const
 {
-  int i = 0;
+  // Binary search for the first item that the new item is not greater than
+
+  int bottom = 0;
+  int top    = m_items.size();
+
+  while (bottom < top)
+    {
+      int mid = (bottom + top) >> 1;
+
+      if (item->compareTo(m_items[mid]) > 0)
+        {
+          bottom = mid + 1;
+        }
+      else
+        {
+          top = mid;
+        }
+    }
+
+  return bottom;
+}
+
+/**
+ * Select or deselect a single item, keeping the count and the index of
+ * the first selected item up to date.  Raises no events.
+ *
+ * @param index The index of the item.
+ * @param selected True to select the item, false to deselect it.
+ */
+
+void CListData::setSelectionState(const int index, const bool selected)
+{
+  CListDataItem *item = m_items[index];
 
-  // Locate slot where new option should go
+  if (item->isSelected() == selected)
+    {
+      return;
+    }
 
-  while ((i < m_items.size()) && (item->compareTo(m_items[i]) > 0))
+  item->setSelected(selected);
+
+  if (selected)
     {
-      i++;
+      m_selectedCount++;
+
+      if (m_firstSelected < 0 || index < m_firstSelected)
+        {
+          m_firstSelected = index;
+        }
     }
-  return i;
+  else
+    {
+      m_selectedCount--;
+
+      if (index == m_firstSelected)
+        {
+          m_firstSelected = findSelectedItem(index + 1);
+        }
+    }
+}
+
+/**
+ * Find the first selected item at or after the specified index.
+ *
+ * @param start The index to start searching from.
+ * @return The index of the selected item, or -1 if there is none.
+ */
+
+const int CListData::findSelectedItem(const int start) const
+{
+  if (m_selectedCount > 0)
+    {
+      for (int i = start; i < m_items.size(); i++)
+        {
+          if (m_items[i]->isSelected())
+            {
+              return i;
+            }
+        }
+    }
+
+  return -1;
 }
 
 /**
  * Raise a data changed event.
+ *
+ * @param index The index of the only item that changed, or -1 if any
+ *   number of items may have changed.
  */
 
-void CListData::raiseDataChangedEvent(void)
+void CListData::raiseDataChangedEvent(const int index)
 {
-  CListDataEventArgs eventArgs(this);
+  CListDataEventArgs eventArgs(this, index);
 
   for (int i = 0; i < m_listDataEventhandlers.size(); ++i)
     {
@@ -434,11 +566,14 @@ void CListData::raiseDataChangedEvent(void)
 
 /**
  * Raise a selection changed event.
+ *
+ * @param index The index of the only item whose selection changed, or
+ *   -1 if any number of items may have changed.
  */
 
-void CListData::raiseSelectionChangedEvent(void)
+void CListData::raiseSelectionChangedEvent(const int index)
 {
-  CListDataEventArgs eventArgs(this);
+  CListDataEventArgs eventArgs(this, index);
 
   for (int i = 0; i < m_listDataEventhandlers.size(); ++i)
     {
@@ -153,7 +153,7 @@ CMultiLineTextBox::CMultiLineTextBox(CWidgetControl *pWidgetControl,
 void CMultiLineTextBox::setTextAlignmentHoriz(TextAlignmentHoriz alignment)
 {
   m_hAlignment = alignment;
-  redraw();
+  invalidate();
 }
 
 /**
@@ -165,7 +165,7 @@ void CMultiLineTextBox::setTextAlignmentHoriz(TextAlignmentHoriz alignment)
 void CMultiLineTextBox::setTextAlignmentVert(TextAlignmentVert alignment)
 {
   m_vAlignment = alignment;
-  redraw();
+  invalidate();
 }
 
 /**
@@ -234,7 +234,7 @@ void CMultiLineTextBox::setText(const CNxString &text)
     {
       enableDrawing();
     }
-  redraw();
+  invalidate();
 
   m_widgetEventHandlers->raiseValueChangeEvent();
 }
@@ -261,7 +261,7 @@ void CMultiLineTextBox::appendText(const CNxString &text)
     {
       enableDrawing();
     }
-  redraw();
+  invalidate();
 
   m_widgetEventHandlers->raiseValueChangeEvent();
 }
@@ -302,7 +302,7 @@ void CMultiLineTextBox::removeText(const unsigned int startIndex,
     {
       enableDrawing();
     }
-  redraw();
+  invalidate();
 
   m_widgetEventHandlers->raiseValueChangeEvent();
 }
@@ -329,7 +329,7 @@ void CMultiLineTextBox::setFont(CNxFont *font)
     {
       enableDrawing();
     }
-  redraw();
+  invalidate();
 
   m_widgetEventHandlers->raiseValueChangeEvent();
 }
@@ -356,7 +356,7 @@ void CMultiLineTextBox::showCursor(EShowCursor cursorMode)
   if (m_showCursor != cursorMode)
    {
       m_showCursor = (uint8_t)cursorMode;
-      redraw();
+      invalidate();
     }
 }
 
@@ -417,7 +417,7 @@ void CMultiLineTextBox::insertText(const CNxString &text,
     {
       enableDrawing();
     }
-  redraw();
+  invalidate();
 
   m_widgetEventHandlers->raiseValueChangeEvent();
 }
@@ -609,6 +609,20 @@ CMultiLineTextBox::getCharIndexAtCoordinates(nxgl_coord_t x, nxgl_coord_t y) con
 
 int CMultiLineTextBox::getRowContainingCoordinate(nxgl_coord_t y) const
 {
+  // If the text is top-aligned, the rows are evenly spaced from the top of
+  // the canvas and there is no need to search
+
+  if (m_visibleRows <= m_text->getLineCount())
+    {
+      if (y < 0)
+        {
+          return 0;
+        }
+
+      int row = y / m_text->getLineHeight();
+      return row < m_text->getLineCount() ? row : m_text->getLineCount() - 1;
+    }
+
   int row = -1;
 
   // Locate the row containing the character
@@ -1159,9 +1173,34 @@ void CMultiLineTextBox::drawText(CGraphicsPort *port)
   // Determine the top and bottom rows within the graphicsport's clip rect.
   // We only draw these rows in order to increase the speed of the routine.
 
-  int regionY   = -m_canvasY;  // Y coord of canvas visible region
+  CRect rect;
+  getRect(rect);
+
+  int top    = rect.getY();
+  int bottom = rect.getY() + m_rect.getHeight();
+
+  CRect clip;
+  if (port->getClipRect(clip))
+    {
+      if (clip.getY() > top)
+        {
+          top = clip.getY();
+        }
+
+      if (clip.getY() + clip.getHeight() < bottom)
+        {
+          bottom = clip.getY() + clip.getHeight();
+        }
+
+      if (bottom <= top)
+        {
+          return;
+        }
+    }
+
+  int regionY   = top - rect.getY() - m_canvasY;  // Y coord of canvas visible region
   int topRow    = getRowContainingCoordinate(regionY);
-  int bottomRow = getRowContainingCoordinate(regionY + m_rect.getHeight());
+  int bottomRow = getRowContainingCoordinate(regionY + (bottom - top));
 
   // Early exit checks
 
@@ -258,7 +258,7 @@ void CNumericEdit::updateText()
 
   m_widgetEventHandlers->raiseValueChangeEvent();
 
-  redraw();
+  invalidate();
 }
 
 void CNumericEdit::setUnit(const CNxString& text)
@@ -34,7 +34,6 @@
 
 #include "graphics/nxwidgets/nxconfig.hxx"
 #include "graphics/nxwidgets/cnxstring.hxx"
-#include "graphics/nxwidgets/cstringiterator.hxx"
 #include "graphics/nxwidgets/cnxfont.hxx"
 #include "graphics/nxwidgets/cbitmap.hxx"
 
@@ -65,6 +64,29 @@ CNxFont::CNxFont(enum nx_fontid_e fontid, nxgl_mxpixel_t fontColor,
   m_pFontSet         = nxf_getfontset(m_fontHandle);
   m_fontColor        = fontColor;
   m_transparentColor = transparentColor;
+
+#ifdef CONFIG_NXWIDGETS_FONTWIDTHS
+  // Look up the width of every 8-bit character once.  Text layout measures
+  // strings repeatedly, and this avoids a font lookup for each character.
+
+  for (int i = 0; i < 256; i++)
+    {
+      FAR const struct nx_fontbitmap_s *fbm;
+      unsigned int width;
+
+      fbm = nxf_getbitmap(m_fontHandle, (uint16_t)i);
+      if (fbm)
+        {
+          width = fbm->metric.width + fbm->metric.xoffset;
+        }
+      else
+        {
+          width = m_pFontSet->spwidth;
+        }
+
+      m_charWidths[i] = width < 256 ? width : 255;
+    }
+#endif
 }
 
 /**
@@ -126,32 +148,7 @@ void CNxFont::drawChar(FAR SBitmap *bitmap, nxwidget_char_t letter)
 
 nxgl_coord_t CNxFont::getStringWidth(const CNxString &text) const
 {
-  CStringIterator *iter = text.newStringIterator();
-
-  // Get the width of the string of characters
-  // Move to the first character
-
-  unsigned int width = 0;
-  if (iter->moveToFirst())
-    {
-      // moveToFirst returns true if there is at least one character
-
-      do
-        {
-          // Add the width of the font bitmap for this character and
-          // move the the next character
-
-          nxwidget_char_t ch = iter->getChar();
-
-          width += getCharWidth(ch);
-        }
-      while (iter->moveToNext());
-    }
-
-  // Return the total width
-
-  delete iter;
-  return width;
+  return getStringWidth(text.getView());
 }
 
 /**
@@ -167,32 +164,7 @@ nxgl_coord_t CNxFont::getStringWidth(const CNxString &text) const
 nxgl_coord_t CNxFont::getStringWidth(const CNxString &text,
                                      int startIndex, int length) const
 {
-  CStringIterator *iter = text.newStringIterator();
-
-  // Get the width of the string of characters
-
-  iter->moveTo(startIndex);
-  unsigned int width = 0;
-
-  while (length-- > 0)
-    {
-      // Add the width of the font bitmap for this character
-
-      nxwidget_char_t ch = iter->getChar();
-      width += getCharWidth(ch);
-
-      // Position to the next character in the string
-
-      if (!iter->moveToNext())
-        {
-          break;
-        }
-    }
-
-  // Return the total width
-
-  delete iter;
-  return width;
+  return getStringWidth(text.subStringView(startIndex, length));
 }
 
 /**
@@ -241,6 +213,13 @@ nxgl_coord_t CNxFont::getCharWidth(nxwidget_char_t letter) const
   FAR const struct nx_fontbitmap_s *fbm;
   nxgl_coord_t width;
 
+#ifdef CONFIG_NXWIDGETS_FONTWIDTHS
+  if ((unsigned int)letter < 256)
+    {
+      return m_charWidths[letter];
+    }
+#endif
+
   /* Get the font bitmap for this character */
 
   fbm = nxf_getbitmap(m_fontHandle, letter);
@@ -259,3 +238,34 @@ nxgl_coord_t CNxFont::getCharWidth(nxwidget_char_t letter) const
 
   return width;
 }
+
+/**
+ * Get the width of a run of characters in pixels.
+ *
+ * @param text The first character of the run.
+ * @param length The number of characters in the run.
+ * @return The width of the run in pixels.
+ */
+
+nxgl_coord_t CNxFont::getRunWidth(FAR const nxwidget_char_t *text,
+                                  int length) const
+{
+  unsigned int width = 0;
+
+  for (int i = 0; i < length; i++)
+    {
+      nxwidget_char_t ch = text[i];
+
+#ifdef CONFIG_NXWIDGETS_FONTWIDTHS
+      if ((unsigned int)ch < 256)
+        {
+          width += m_charWidths[ch];
+          continue;
+        }
+#endif
+
+      width += getCharWidth(ch);
+    }
+
+  return width;
+}
@@ -80,10 +80,7 @@ using namespace NXWidgets;
 
 CNxString::CNxString()
 {
-  m_text          = NULL;
-  m_stringLength  = 0;
-  m_allocatedSize = 0;
-  m_growAmount    = 16;
+  initialize();
 }
 
 /**
@@ -95,10 +92,7 @@ CNxString::CNxString()
 
 CNxString::CNxString(FAR const char *text)
 {
-  m_text          = NULL;
-  m_stringLength  = 0;
-  m_allocatedSize = 0;
-  m_growAmount    = 16;
+  initialize();
 
   setText(text);
 }
@@ -110,24 +104,45 @@ CNxString::CNxString(FAR const char *text)
 
 CNxString::CNxString(const nxwidget_char_t text)
 {
-  m_text          = NULL;
-  m_stringLength  = 0;
-  m_allocatedSize = 0;
-  m_growAmount    = 16;
+  initialize();
 
   setText(text);
 }
 
 CNxString::CNxString(const CNxString &string)
 {
-  m_text          = NULL;
-  m_stringLength  = 0;
-  m_allocatedSize = 0;
-  m_growAmount    = 16;
+  initialize();
 
   setText(string);
 }
 
+/**
+ * Move constructor.  The memory of the argument string is taken over and
+ * the argument string is left empty.
+ *
+ * @param string CNxString object to move from.
+ */
+
+CNxString::CNxString(CNxString &&string)
+{
+  initialize();
+
+  *this = static_cast<CNxString &&>(string);
+}
+
+/**
+ * Constructor to create a string from a string view.
+ *
+ * @param view The characters to copy.
+ */
+
+CNxString::CNxString(const CNxStringView &view)
+{
+  initialize();
+
+  setText(view);
+}
+
 /**
  * Creates and returns a new CCStringIterator object that will iterate
  * over this string.  The object must be manually deleted once it is
@@ -340,12 +355,16 @@ void CNxString::insert(const CNxString &text, int index)
 
       // Delete existing string
 
-      delete[] m_text;
+      if (isAllocated())
+        {
+          delete[] getAllocation();
+        }
 
       // Swap pointers
 
       m_stringLength = newLength;
       m_text         = newText;
+      m_headroom     = 0;
     }
   else
     {
@@ -420,6 +439,19 @@ void CNxString::remove(const int startIndex, const int count)
       return;
     }
 
+  // Removing characters from the front of the string just moves the start of
+  // the string forward.  The released memory is reclaimed by allocateMemory()
+  // when the string next needs to grow.
+
+  if (startIndex == 0)
+    {
+      m_text          += count;
+      m_headroom      += count;
+      m_allocatedSize -= count * sizeof(nxwidget_char_t);
+      m_stringLength  -= count;
+      return;
+    }
+
   // Copy characters from a point after the area to be deleted into the space created
   // by the deletion
 
@@ -629,28 +661,12 @@ CNxString* CNxString::subString(int startIndex) const
 
 CNxString *CNxString::subString(int startIndex, int length) const
 {
-  CNxString *newString = new CNxString();
-  CStringIterator *iterator = new CStringIterator(this);
-
-  if (!iterator->moveTo(startIndex))
+  if ((unsigned int)startIndex >= (unsigned int)m_stringLength)
     {
-      delete iterator;
       return (CNxString *)0;
     }
 
-  // Build up the string character by character.  We could do a memcpy
-  // here and improve performance.
-
-  int count = 0;
-  while (count < length)
-    {
-      newString->append(iterator->getChar());
-      iterator->moveToNext();
-      count++;
-    }
-
-  delete iterator;
-  return newString;
+  return new CNxString(subStringView(startIndex, length));
 }
 
 /**
@@ -671,6 +687,44 @@ CNxString& CNxString::operator=(const CNxString &string)
   return *this;
 }
 
+/**
+ * Overloaded move assignment operator.  The memory of the argument string is
+ * taken over and the argument string is left empty.
+ *
+ * @param string The string to move from.
+ * @return This string.
+ */
+
+CNxString& CNxString::operator=(CNxString &&string)
+{
+  if (&string == this)
+    {
+      return *this;
+    }
+
+  // Strings held within the object must be copied
+
+  if (!string.isAllocated())
+    {
+      setText(string);
+      string.m_stringLength = 0;
+      return *this;
+    }
+
+  if (isAllocated())
+    {
+      delete[] getAllocation();
+    }
+
+  m_text          = string.m_text;
+  m_headroom      = string.m_headroom;
+  m_stringLength  = string.m_stringLength;
+  m_allocatedSize = string.m_allocatedSize;
+
+  string.initialize();
+  return *this;
+}
+
 /**
  * Overloaded assignment operator.  Copies the data within the argument
  * char array to this string.
@@ -740,30 +794,49 @@ void CNxString::allocateMemory(int nChars, bool preserve)
   // Do we already have enough memory allocated to contain this new size?
   // If so, we can avoid deallocating and allocating new memory by re-using the old
 
-  if (nBytesNeeded > m_allocatedSize)
+  if (nBytesNeeded > m_allocatedSize &&
+      nBytesNeeded <= m_allocatedSize +
+                      m_headroom * (int)sizeof(nxwidget_char_t))
+    {
+      // The memory released from the front of the string is enough, so
+      // move the string back to the start of its memory
+
+      FAR nxwidget_char_t *start = getAllocation();
+
+      if (preserve)
+        {
+          memmove(start, m_text, sizeof(nxwidget_char_t) * m_stringLength);
+        }
+
+      m_text           = start;
+      m_allocatedSize += m_headroom * sizeof(nxwidget_char_t);
+      m_headroom       = 0;
+    }
+  else if (nBytesNeeded > m_allocatedSize)
     {
       // Not enough space in existing memory; allocate new memory
 
       int allocChars = nChars + m_growAmount;
       nxwidget_char_t *newText = new nxwidget_char_t[allocChars];
 
-      // Free old memory if necessary
+      // Preserve existing data if required
 
-      if (m_text != NULL)
+      if (m_text != NULL && preserve)
         {
-          // Preserve existing data if required
+          memcpy(newText, m_text, sizeof(nxwidget_char_t) * m_stringLength);
+        }
 
-          if (preserve)
-            {
-              memcpy(newText, m_text, sizeof(nxwidget_char_t) * m_stringLength);
-            }
+      // Free old memory if necessary
 
-          delete[] m_text;
+      if (isAllocated())
+        {
+          delete[] getAllocation();
         }
 
       // Set pointer to new memory
 
-      m_text = newText;
+      m_text     = newText;
+      m_headroom = 0;
 
       // Remember how much memory we've allocated.
 
@@ -771,6 +844,26 @@ void CNxString::allocateMemory(int nChars, bool preserve)
     }
 }
 
+/**
+ * Initialize an empty string.  Used by the constructors.
+ */
+
+void CNxString::initialize(void)
+{
+#ifdef CONFIG_NXWIDGETS_STRINGINLINE
+  // Short strings are held in the object itself
+
+  m_text          = m_inline;
+  m_allocatedSize = sizeof(m_inline);
+#else
+  m_text          = NULL;
+  m_allocatedSize = 0;
+#endif
+  m_stringLength  = 0;
+  m_growAmount    = 16;
+  m_headroom      = 0;
+}
+
 /**
  * Return a pointer to the specified characters.
  *
@@ -68,6 +68,8 @@
 #include <nuttx/clock.h>
 #include <nuttx/wqueue.h>
 
+#include "graphics/nxwidgets/cwidgetcontrol.hxx"
+#include "graphics/nxwidgets/ctimerqueue.hxx"
 #include "graphics/nxwidgets/cnxtimer.hxx"
 
 /****************************************************************************
@@ -103,9 +105,13 @@ CNxTimer::CNxTimer(CWidgetControl *pWidgetControl, uint32_t timeout, bool repeat
   m_isRepeater = repeat;
   m_isRunning  = false;
 
+#ifdef CONFIG_NXWIDGETS_TIMERQUEUE
+  m_deadline   = 0;
+#else
   // Reset the work structure
 
   memset(&m_work, 0, sizeof(m_work));
+#endif
 }
 
 /**
@@ -138,6 +144,11 @@ void CNxTimer::reset(void)
 
 void CNxTimer::start(void)
 {
+#ifdef CONFIG_NXWIDGETS_TIMERQUEUE
+  // The window's timer queue ignores timers that are already running
+
+  m_widgetControl->getTimerQueue()->startTimer(this);
+#else
   // If the timer is running, reset should be used to restart it
 
   if (!m_isRunning)
@@ -152,6 +163,7 @@ void CNxTimer::start(void)
 
       m_isRunning = true;
     }
+#endif
 }
 
 /**
@@ -160,6 +172,9 @@ void CNxTimer::start(void)
 
 void CNxTimer::stop(void)
 {
+#ifdef CONFIG_NXWIDGETS_TIMERQUEUE
+  m_widgetControl->getTimerQueue()->stopTimer(this);
+#else
   if (m_isRunning)
     {
       int ret = work_cancel(USRWORK, &m_work);
@@ -171,8 +186,16 @@ void CNxTimer::stop(void)
 
       m_isRunning = false;
     }
+#endif
 }
 
+/**
+ * Static function called from work queue when the timeout expires.
+ *
+ * @param arg Pointer to the CNxTimer instance.
+ */
+
+#ifndef CONFIG_NXWIDGETS_TIMERQUEUE
 void CNxTimer::workQueueCallback(FAR void *arg)
 {
   CNxTimer* This = (CNxTimer*)arg;
@@ -190,3 +213,4 @@ void CNxTimer::workQueueCallback(FAR void *arg)
 
   This->m_widgetEventHandlers->raiseActionEvent();
 }
+#endif
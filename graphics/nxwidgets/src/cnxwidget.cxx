@@ -488,6 +488,62 @@ void CNxWidget::redraw(void)
     }
 }
 
+/**
+ * Draws the parts of the widget and of its child widgets that intersect a
+ * region of the window.
+ *
+ * @param rect The window-relative region to redraw.
+ */
+
+void CNxWidget::redrawRegion(const CRect &rect)
+{
+  if (isDrawingEnabled())
+    {
+      CRect bounds(getX(), getY(), getWidth(), getHeight());
+      if (!bounds.intersects(rect))
+        {
+          return;
+        }
+
+      // Get the graphics port needed to draw on this window
+
+      CGraphicsPort *port = m_widgetControl->getGraphicsPort();
+
+      // Draw the Widget
+
+      drawBorder(port);
+      drawContents(port);
+
+      // Remember that the widget is no longer erased
+
+      m_flags.erased = false;
+
+      // Draw the children of the widget that intersect the region
+
+      for (int i = 0; i < m_children.size(); i++)
+        {
+          m_children[i]->redrawRegion(rect);
+        }
+    }
+}
+
+/**
+ * Marks the widget as needing to be redrawn.
+ */
+
+void CNxWidget::invalidate(void)
+{
+#ifdef CONFIG_NXWIDGETS_DAMAGE
+  if (isDrawingEnabled())
+    {
+      m_widgetControl->invalidate(CRect(getX(), getY(),
+                                        getWidth(), getHeight()));
+    }
+#else
+  redraw();
+#endif
+}
+
 /**
  * Enables the widget.
  *
@@ -500,7 +556,7 @@ bool CNxWidget::enable(void)
     {
       m_flags.enabled = true;
       onEnable();
-      redraw();
+      invalidate();
       m_widgetEventHandlers->raiseEnableEvent();
       return true;
     }
@@ -520,7 +576,7 @@ bool CNxWidget::disable(void)
     {
       m_flags.enabled = false;
       onDisable();
-      redraw();
+      invalidate();
       m_widgetEventHandlers->raiseDisableEvent();
       return true;
     }
@@ -574,7 +630,7 @@ bool CNxWidget::show(void)
       m_flags.hidden = false;
 
       m_widgetEventHandlers->raiseShowEvent();
-      redraw();
+      invalidate();
       return true;
     }
 
@@ -1045,7 +1101,7 @@ bool CNxWidget::moveTo(nxgl_coord_t x, nxgl_coord_t y)
       m_rect.setX(x);
       m_rect.setY(y);
 
-      redraw();
+      invalidate();
       m_widgetEventHandlers->raiseMoveEvent(x, y, x - oldX, y - oldY);
     }
 
@@ -1112,7 +1168,7 @@ bool CNxWidget::resize(nxgl_coord_t width, nxgl_coord_t height)
       // Reset drawing value
 
       m_flags.drawingEnabled = wasDrawEnabled;
-      redraw();
+      invalidate();
       m_widgetEventHandlers->raiseResizeEvent(width, height);
     }
 
@@ -1264,6 +1320,72 @@ bool CNxWidget::checkCollision(CNxWidget *widget) const
   return rect.intersects(m_rect);
 }
 
+/**
+ * Checks if any visible widget that is drawn after this widget overlaps
+ * it.  If not, the pixels of the widget in the window belong only to
+ * this widget and its children.
+ *
+ * @return True if the widget may be partly covered by another widget.
+ */
+
+bool CNxWidget::isObscured(void) const
+{
+  CRect bounds(getX(), getY(), getWidth(), getHeight());
+
+  // Siblings later in the child stack of this widget or of any of its
+  // ancestors are drawn on top of it
+
+  const CNxWidget *widget = this;
+
+  while (widget->m_parent != NULL)
+    {
+      const CNxWidget *parent = widget->m_parent;
+      bool above = false;
+
+      for (int i = 0; i < parent->m_children.size(); i++)
+        {
+          const CNxWidget *sibling = parent->m_children[i];
+
+          if (sibling == widget)
+            {
+              above = true;
+            }
+          else if (above && !sibling->isHidden() &&
+                   bounds.intersects(CRect(sibling->getX(), sibling->getY(),
+                                           sibling->getWidth(),
+                                           sibling->getHeight())))
+            {
+              return true;
+            }
+        }
+
+      widget = parent;
+    }
+
+  // So are top-level widgets that were added to the window after the
+  // top-level ancestor
+
+  bool above = false;
+
+  for (int i = 0; i < m_widgetControl->getControlledWidgetCount(); i++)
+    {
+      const CNxWidget *other = m_widgetControl->getControlledWidget(i);
+
+      if (other == widget)
+        {
+          above = true;
+        }
+      else if (above && other->getParent() == NULL && !other->isHidden() &&
+               bounds.intersects(CRect(other->getX(), other->getY(),
+                                       other->getWidth(), other->getHeight())))
+        {
+          return true;
+        }
+    }
+
+  return false;
+}
+
 /**
  * Adds a widget to this widget's child stack.  The widget is added to the
  * top of the stack.  Note that the widget can only be added if it is not
@@ -1288,7 +1410,7 @@ void CNxWidget::addWidget(CNxWidget *widget)
         }
 
       widget->enableDrawing();
-      widget->redraw();
+      widget->invalidate();
     }
 }
 
@@ -1309,7 +1431,7 @@ void CNxWidget::insertWidget(CNxWidget *widget)
       m_children.insert(0, widget);
 
       widget->enableDrawing();
-      widget->redraw();
+      widget->invalidate();
     }
 }
 
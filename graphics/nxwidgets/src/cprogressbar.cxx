@@ -123,7 +123,7 @@ void CProgressBar::setValue(const int16_t value)
       m_value = m_minimumValue;
     }
 
-  redraw();
+  invalidate();
 }
 
 /**
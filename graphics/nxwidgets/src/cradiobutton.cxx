@@ -126,7 +126,7 @@ void CRadioButton::setState(CRadioButton::RadioButtonState state)
         }
 
       m_widgetEventHandlers->raiseValueChangeEvent();
-      redraw();
+      invalidate();
     }
 }
 
@@ -194,7 +194,7 @@ void CRadioButton::drawContents(CGraphicsPort *port)
   // Draw button
 
   port->drawBitmap(x, y, width, height, glyph, 0, 0,
-                   CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
+                   CONFIG_NXWIDGETS_TRANSPARENT_COLOR, true);
 }
 
 /**
@@ -0,0 +1,148 @@
+/****************************************************************************
+ * apps/graphics/nxwidgets/src/crectlist.cxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <debug.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/crect.hxx"
+#include "graphics/nxwidgets/crectlist.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Method Implementations
+ ****************************************************************************/
+
+using namespace NXWidgets;
+
+/**
+ * Constructor.
+ *
+ * @param maxRects The maximum number of separate rectangles.
+ */
+
+CRectList::CRectList(uint8_t maxRects)
+{
+  m_nRects   = 0;
+  m_maxRects = maxRects > 0 ? maxRects : 1;
+
+  m_rects    = new CRect[m_maxRects];
+  if (!m_rects)
+    {
+      gerr("ERROR: Failed to allocate the rectangle list\n");
+      m_maxRects = 0;
+    }
+}
+
+/**
+ * Destructor.
+ */
+
+CRectList::~CRectList(void)
+{
+  if (m_rects)
+    {
+      delete[] m_rects;
+    }
+}
+
+/**
+ * Add a rectangle to the list, merging it with any rectangles that it
+ * overlaps or touches.
+ *
+ * @param rect The rectangle to add.
+ */
+
+void CRectList::addRect(const CRect &rect)
+{
+  if (!rect.hasDimensions() || m_maxRects == 0)
+    {
+      return;
+    }
+
+  CRect merged(rect);
+
+  for (; ; )
+    {
+      // Absorb every rectangle that overlaps or touches the new one.  The
+      // combined rectangle may now reach other rectangles, so start over
+      // after each merge.
+
+      int i = 0;
+      while (i < m_nRects)
+        {
+          CRect touching(m_rects[i].getX() - 1, m_rects[i].getY() - 1,
+                         m_rects[i].getWidth() + 2,
+                         m_rects[i].getHeight() + 2);
+
+          if (touching.intersects(merged))
+            {
+              merged.expandToInclude(m_rects[i]);
+              removeRect(i);
+              i = 0;
+            }
+          else
+            {
+              i++;
+            }
+        }
+
+      if (m_nRects < m_maxRects)
+        {
+          break;
+        }
+
+      // There is no room for another rectangle.  Absorb the one whose
+      // bounding box with the new rectangle adds the least area.
+
+      int best          = 0;
+      uint32_t bestArea = UINT32_MAX;
+
+      for (i = 0; i < m_nRects; i++)
+        {
+          CRect addition;
+          merged.getAddition(m_rects[i], addition);
+
+          uint32_t area = (uint32_t)addition.getWidth() * addition.getHeight() -
+                          (uint32_t)m_rects[i].getWidth() * m_rects[i].getHeight();
+
+          if (area < bestArea)
+            {
+              best     = i;
+              bestArea = area;
+            }
+        }
+
+      merged.expandToInclude(m_rects[best]);
+      removeRect(best);
+    }
+
+  m_rects[m_nRects++] = merged;
+}
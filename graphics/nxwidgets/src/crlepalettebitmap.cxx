@@ -61,6 +61,7 @@
 #include <cstdint>
 #include <cstdbool>
 #include <cstring>
+#include <debug.h>
 
 #include <nuttx/nx/nxglib.h>
 
@@ -87,9 +88,42 @@ CRlePaletteBitmap::CRlePaletteBitmap(const struct SRlePaletteBitmap *bitmap)
 {
   m_bitmap      = bitmap;
   m_lut         = bitmap->lut[0];
+#ifdef CONFIG_NXWIDGETS_RLEEXPANDED
+  m_pixels      = bitmap->pixels[0];
+  m_expanded[0] = (FAR nxwidget_pixel_t *)0;
+  m_expanded[1] = (FAR nxwidget_pixel_t *)0;
+  m_selected    = false;
+#endif
+#ifdef CONFIG_NXWIDGETS_RLEINDEX
+  m_index       = (FAR struct SRleRowStart *)0;
+#endif
   startOfImage();
 }
 
+/**
+ * Destructor.
+ */
+
+CRlePaletteBitmap::~CRlePaletteBitmap(void)
+{
+#ifdef CONFIG_NXWIDGETS_RLEINDEX
+  if (m_index)
+    {
+      delete[] m_index;
+    }
+#endif
+
+#ifdef CONFIG_NXWIDGETS_RLEEXPANDED
+  for (int i = 0; i < 2; i++)
+    {
+      if (m_expanded[i])
+        {
+          delete[] m_expanded[i];
+        }
+    }
+#endif
+}
+
 /**
  * Get the bitmap's color format.
  *
@@ -157,6 +191,14 @@ const size_t CRlePaletteBitmap::getStride(void) const
 void CRlePaletteBitmap::setSelected(bool selected)
 {
   m_lut = m_bitmap->lut[selected ? 1 : 0];
+#ifdef CONFIG_NXWIDGETS_RLEEXPANDED
+  m_selected = selected;
+  m_pixels   = m_bitmap->pixels[selected ? 1 : 0];
+  if (!m_pixels)
+    {
+      m_pixels = m_expanded[selected ? 1 : 0];
+    }
+#endif
 }
 
 /**
@@ -180,6 +222,27 @@ bool CRlePaletteBitmap::getRun(nxgl_coord_t x, nxgl_coord_t y, nxgl_coord_t widt
   if (((unsigned int)x           <  (unsigned int)m_bitmap->width) &&
       ((unsigned int)(x + width) <= (unsigned int)m_bitmap->width))
     {
+#ifdef CONFIG_NXWIDGETS_RLEEXPANDED
+      // Use the expanded copy that was generated with the image, or else
+      // expand the image the first time that it is drawn.  The run can
+      // then be copied directly without decoding the RLE data.
+
+      if (m_pixels || expandImage())
+        {
+          if ((unsigned int)y >= (unsigned int)m_bitmap->height)
+            {
+              return false;
+            }
+
+          FAR const nxwidget_pixel_t *start =
+            (FAR const nxwidget_pixel_t *)m_pixels +
+            (size_t)y * m_bitmap->width + x;
+
+          memcpy(data, start, width * sizeof(nxwidget_pixel_t));
+          return true;
+        }
+
+#endif
       // Seek to the requested row
 
       if (!seekRow(y))
@@ -310,9 +373,43 @@ bool CRlePaletteBitmap::seekRow(nxgl_coord_t row)
 {
   // Is the current position already past the requested position?
 
-  if (row < m_row || (row == m_row && m_col != 0))
+  bool rewind = (row < m_row || (row == m_row && m_col != 0));
+
+#ifdef CONFIG_NXWIDGETS_RLEINDEX
+  if ((unsigned int)row >= (unsigned int)m_bitmap->height)
     {
-      // Yes.. rewind to the beginning of the image
+      return false;
+    }
+
+  // Start from the closest indexed row if that is nearer than the current
+  // position.  The index is built the first time that it is needed.
+
+  nxgl_coord_t base = row - row % CONFIG_NXWIDGETS_RLEINDEX_INTERVAL;
+  if (rewind || base > m_row)
+    {
+      if (m_index || buildIndex())
+        {
+          FAR struct SRleRowStart *start =
+            &m_index[row / CONFIG_NXWIDGETS_RLEINDEX_INTERVAL];
+
+          m_row       = base;
+          m_col       = 0;
+          m_rle       = start->rle;
+          m_remaining = start->remaining;
+          rewind      = false;
+        }
+      else
+        {
+          // The position was lost while trying to build the index
+
+          rewind      = true;
+        }
+    }
+#endif
+
+  if (rewind)
+    {
+      // Rewind to the beginning of the image
 
       startOfImage();
     }
@@ -331,6 +428,91 @@ bool CRlePaletteBitmap::seekRow(nxgl_coord_t row)
   return true;
 }
 
+#ifdef CONFIG_NXWIDGETS_RLEINDEX
+/**
+ * Build the row index by decoding the image once.  The current position is
+ * lost.
+ *
+ * @return False if the index could not be allocated
+ */
+
+bool CRlePaletteBitmap::buildIndex(void)
+{
+  int nEntries = (m_bitmap->height + CONFIG_NXWIDGETS_RLEINDEX_INTERVAL - 1) /
+                 CONFIG_NXWIDGETS_RLEINDEX_INTERVAL;
+
+  m_index = new struct SRleRowStart[nEntries];
+  if (!m_index)
+    {
+      gerr("ERROR: Failed to allocate the RLE row index\n");
+      return false;
+    }
+
+  // Record the decoder position at the start of every indexed row.  Never
+  // decode beyond the beginning of the last indexed row.
+
+  startOfImage();
+  for (int i = 0; i < nEntries; i++)
+    {
+      nxgl_coord_t row = i * CONFIG_NXWIDGETS_RLEINDEX_INTERVAL;
+      while (m_row < row)
+        {
+          if (!nextRow())
+            {
+              delete[] m_index;
+              m_index = (FAR struct SRleRowStart *)0;
+              return false;
+            }
+        }
+
+      m_index[i].rle       = m_rle;
+      m_index[i].remaining = m_remaining;
+    }
+
+  return true;
+}
+#endif
+
+#ifdef CONFIG_NXWIDGETS_RLEEXPANDED
+/**
+ * Expand the complete image using the selected LUT by decoding the RLE
+ * data once.  This is used for images that were generated without
+ * expanded copies.  The current position is lost.
+ *
+ * @return False if the expanded image could not be allocated
+ */
+
+bool CRlePaletteBitmap::expandImage(void)
+{
+  FAR nxwidget_pixel_t *pixels =
+    new nxwidget_pixel_t[(size_t)m_bitmap->width * m_bitmap->height];
+
+  if (!pixels)
+    {
+      gerr("ERROR: Failed to allocate the expanded RLE image\n");
+      return false;
+    }
+
+  // Decode the image row by row using the selected LUT
+
+  startOfImage();
+  for (nxgl_coord_t row = 0; row < m_bitmap->height; row++)
+    {
+      if (!copyPixels(m_bitmap->width,
+                      &pixels[(size_t)row * m_bitmap->width]))
+        {
+          delete[] pixels;
+          startOfImage();
+          return false;
+        }
+    }
+
+  m_expanded[m_selected ? 1 : 0] = pixels;
+  m_pixels = pixels;
+  return true;
+}
+#endif
+
 /** Copy the pixels from the current RLE entry the specified number of times.
  *
  * @param npixels The number of pixels to copy.  Must be less than or equal
@@ -345,20 +527,49 @@ void CRlePaletteBitmap::copyColor(nxgl_coord_t npixels, FAR void *data)
 {
   // Right now, only a single pixel depth is supported
 
-  nxwidget_pixel_t *nxlut = (nxwidget_pixel_t *)m_lut;
+  FAR const nxwidget_pixel_t *nxlut = (FAR const nxwidget_pixel_t *)m_lut;
   nxwidget_pixel_t color = nxlut[m_rle->lookup];
+  FAR nxwidget_pixel_t *dest = (FAR nxwidget_pixel_t *)data;
 
-  // Copy the requested pixels
+  // Adjust the number of pixels remaining in the RLE entry
 
-  FAR nxwidget_pixel_t *dest = (FAR nxwidget_pixel_t *)data;
-  for (int i = 0; i < npixels; i++)
+  m_remaining -= npixels;
+
+#if CONFIG_NXWIDGETS_BPP < 24
+  // Long runs of 8- or 16-bit pixels are stored a 32-bit word at a time.
+  // Store single pixels until the destination is word aligned.
+
+  const int pixelsPerWord = sizeof(uint32_t) / sizeof(nxwidget_pixel_t);
+  if (npixels >= 2 * pixelsPerWord)
     {
-      *dest++ = color;
+      while (((uintptr_t)dest & (sizeof(uint32_t) - 1)) != 0)
+        {
+          *dest++ = color;
+          npixels--;
+        }
+
+      uint32_t pattern = color;
+#if CONFIG_NXWIDGETS_BPP == 8
+      pattern |= pattern << 8;
+#endif
+      pattern |= pattern << 16;
+
+      FAR uint32_t *wdest = (FAR uint32_t *)dest;
+      for (; npixels >= pixelsPerWord; npixels -= pixelsPerWord)
+        {
+          *wdest++ = pattern;
+        }
+
+      dest = (FAR nxwidget_pixel_t *)wdest;
     }
+#endif
 
-  // Adjust the number of pixels remaining in the RLE entry
+  // Copy the remaining pixels
 
-  m_remaining -= npixels;
+  for (int i = 0; i < npixels; i++)
+    {
+      *dest++ = color;
+    }
 }
 
 /** Copy pixels from the current position
@@ -1,5 +1,5 @@
 /****************************************************************************
- * apps/graphics/nxwidgets/src/cscaledbitmap.hxx
+ * apps/graphics/nxwidgets/src/cscaledbitmap.cxx
  *
  * Licensed to the Apache Software Foundation (ASF) under one or more
  * contributor license agreements.  See the NOTICE file distributed with
@@ -37,6 +37,106 @@
  * Pre-Processor Definitions
  ****************************************************************************/
 
+/****************************************************************************
+ * Private Functions
+ ****************************************************************************/
+
+/**
+ * Get the RGB components of one pixel in a row of the contained bitmap.
+ *
+ * @param row - The row data
+ * @param col - The column of the pixel
+ * @param color - The returned color
+ * @return True if the pixel is transparent
+ */
+
+static inline bool unpackPixel(FAR const uint8_t *row, nxgl_coord_t col,
+                               FAR struct rgbcolor_s &color)
+{
+#if CONFIG_NXWIDGETS_FMT == FB_FMT_RGB8_332
+  uint8_t pixel = row[col];
+  color.r = RGB8RED(pixel);
+  color.g = RGB8GREEN(pixel);
+  color.b = RGB8BLUE(pixel);
+
+#elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB16_565
+  uint16_t pixel = ((FAR const uint16_t *)row)[col];
+  color.r = RGB16RED(pixel);
+  color.g = RGB16GREEN(pixel);
+  color.b = RGB16BLUE(pixel);
+
+#elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB24
+  FAR const uint8_t *ptr = &row[3 * col];
+  color.r = ptr[2];
+  color.g = ptr[1];
+  color.b = ptr[0];
+
+  uint32_t pixel = RGBTO24(color.r, color.g, color.b);
+
+#elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB32
+  uint32_t pixel = ((FAR const uint32_t *)row)[col];
+  color.r = RGB24RED(pixel);
+  color.g = RGB24GREEN(pixel);
+  color.b = RGB24BLUE(pixel);
+
+#else
+#  error Unsupported, invalid, or undefined color format
+#endif
+
+  return pixel == CONFIG_NXWIDGETS_TRANSPARENT_COLOR;
+}
+
+/**
+ * Check if an RGB color is the transparent color.
+ *
+ * @param color - The color to check
+ * @return True if the color is transparent
+ */
+
+static inline bool isTransparent(FAR const struct rgbcolor_s &color)
+{
+#if CONFIG_NXWIDGETS_FMT == FB_FMT_RGB8_332
+  return RGBTO8(color.r, color.g, color.b) == CONFIG_NXWIDGETS_TRANSPARENT_COLOR;
+#elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB16_565
+  return RGBTO16(color.r, color.g, color.b) == CONFIG_NXWIDGETS_TRANSPARENT_COLOR;
+#else
+  return RGBTO24(color.r, color.g, color.b) == CONFIG_NXWIDGETS_TRANSPARENT_COLOR;
+#endif
+}
+
+/**
+ * Interpolate between two colors.  Interpolation is not performed within
+ * transparent regions or between transparent and opaque regions; the color
+ * closest to the position is used instead.
+ *
+ * @param color1 - The first color
+ * @param color2 - The second color
+ * @param transparent - True if either color is transparent
+ * @param weight - The weight of color2 in units of 1/256
+ * @param outcolor - The returned, interpolated color
+ */
+
+static inline void interpolate(FAR const struct rgbcolor_s &color1,
+                               FAR const struct rgbcolor_s &color2,
+                               bool transparent, unsigned int weight,
+                               FAR struct rgbcolor_s &outcolor)
+{
+  if (transparent)
+    {
+      outcolor = weight < 128 ? color1 : color2;
+    }
+  else
+    {
+      // The weights sum to 256 so the result can never exceed 255
+
+      unsigned int remainder = 256 - weight;
+
+      outcolor.r = (color1.r * remainder + color2.r * weight) >> 8;
+      outcolor.g = (color1.g * remainder + color2.g * weight) >> 8;
+      outcolor.b = (color1.b * remainder + color2.b * weight) >> 8;
+    }
+}
+
 /****************************************************************************
  * Method Implementations
  ****************************************************************************/
@@ -53,21 +153,12 @@ using namespace NXWidgets;
 CScaledBitmap::CScaledBitmap(IBitmap *bitmap, struct nxgl_size_s &newSize)
 : m_bitmap(bitmap), m_size(newSize)
 {
-  // xScale will be used to convert a request X position to an X position
-  // in the contained bitmap:
-  //
-  // xImage = xRequested * oldWidth / newWidth
-  //        = xRequested * xScale
-
-  m_xScale = itob16((uint32_t)m_bitmap->getWidth()) / newSize.w;
-
-  // Similarly, yScale will be used to convert a request Y position to a Y
-  // positionin the contained bitmap:
-  //
-  // yImage = yRequested * oldHeight / newHeight
-  //        = yRequested * yScale
+  m_columns = (FAR struct SScaledColumn *)0;
+#ifdef CONFIG_NXWIDGETS_SCALEDCACHE
+  m_frame   = (FAR uint8_t *)0;
+#endif
 
-  m_yScale = itob16((uint32_t)m_bitmap->getHeight()) / newSize.h;
+  setScale();
 
   // Allocate and initialize the row cache
 
@@ -91,13 +182,25 @@ CScaledBitmap::~CScaledBitmap(void)
 
   if (m_rowCache[0])
     {
-      delete m_rowCache[0];
+      delete[] m_rowCache[0];
     }
 
   if (m_rowCache[1])
     {
-      delete m_rowCache[1];
-   }
+      delete[] m_rowCache[1];
+    }
+
+  if (m_columns)
+    {
+      delete[] m_columns;
+    }
+
+#ifdef CONFIG_NXWIDGETS_SCALEDCACHE
+  if (m_frame)
+    {
+      delete[] m_frame;
+    }
+#endif
 
   // We are also responsible for deleting the contained IBitmap
 
@@ -162,6 +265,34 @@ const size_t CScaledBitmap::getStride(void) const
   return (m_bitmap->getBitsPerPixel() * m_size.w + 7) / 8;
 }
 
+/**
+ * Change the scaled size of the image.  Any cached scaled image is
+ * discarded.
+ *
+ * @param newSize The new, scaled size of the image
+ * @return True if the size was changed successfully.
+ */
+
+bool CScaledBitmap::setSize(const struct nxgl_size_s &newSize)
+{
+  if (newSize.w == m_size.w && newSize.h == m_size.h && m_columns)
+    {
+      return true;
+    }
+
+#ifdef CONFIG_NXWIDGETS_SCALEDCACHE
+  if (m_frame)
+    {
+      delete[] m_frame;
+      m_frame = (FAR uint8_t *)0;
+    }
+#endif
+
+  m_size.w = newSize.w;
+  m_size.h = newSize.h;
+  return setScale();
+}
+
 /**
  * Get one row from the bit map image.
  *
@@ -182,6 +313,112 @@ const size_t CScaledBitmap::getStride(void) const
 
 bool CScaledBitmap::getRun(nxgl_coord_t x, nxgl_coord_t y,
                            nxgl_coord_t width, FAR void *data)
+{
+  // Check ranges.  Casts to unsigned int are ugly but permit one-sided comparisons
+
+  if (((unsigned int)x           >= (unsigned int)m_size.w) ||
+      ((unsigned int)(x + width) >  (unsigned int)m_size.w) ||
+      ((unsigned int)y           >= (unsigned int)m_size.h) ||
+      !m_columns)
+    {
+      return false;
+    }
+
+#ifdef CONFIG_NXWIDGETS_SCALEDCACHE
+  // Copy the run from the scaled image, scaling the whole image the first
+  // time that it is used.
+
+  if (m_frame || buildFrame())
+    {
+      unsigned int bpp = m_bitmap->getBitsPerPixel();
+      FAR const uint8_t *src = m_frame + y * getStride() + ((x * bpp) >> 3);
+
+      memcpy(data, src, (width * bpp + 7) >> 3);
+      return true;
+    }
+#endif
+
+  // Otherwise, interpolate the run now
+
+  return scaleRun(x, y, width, data);
+}
+
+/**
+ * Compute the scale factors and the column table for the current scaled
+ * size.
+ *
+ * @return True if the column table was allocated.
+ */
+
+bool CScaledBitmap::setScale(void)
+{
+  nxgl_coord_t bitmapWidth = m_bitmap->getWidth();
+
+  // xScale will be used to convert a request X position to an X position
+  // in the contained bitmap:
+  //
+  // xImage = xRequested * oldWidth / newWidth
+  //        = xRequested * xScale
+
+  m_xScale = itob16((uint32_t)bitmapWidth) / m_size.w;
+
+  // Similarly, yScale will be used to convert a request Y position to a Y
+  // positionin the contained bitmap:
+  //
+  // yImage = yRequested * oldHeight / newHeight
+  //        = yRequested * yScale
+
+  m_yScale = itob16((uint32_t)m_bitmap->getHeight()) / m_size.h;
+
+  // The column positions are the same on every row, so work them out once
+
+  if (m_columns)
+    {
+      delete[] m_columns;
+    }
+
+  m_columns = new struct SScaledColumn[m_size.w];
+  if (!m_columns)
+    {
+      gerr("ERROR: Failed to allocate the column table\n");
+      return false;
+    }
+
+  for (nxgl_coord_t x = 0; x < m_size.w; x++)
+    {
+      // Get the column number in the unscaled row corresponding to the
+      // scaled x position.  This must be either the exact column or the
+      // closest column just before the requested position
+
+      b16_t column = x * m_xScale;
+      nxgl_coord_t col1 = b16toi(column);
+      nxgl_coord_t col2 = col1 + 1;
+
+      if (col2 >= bitmapWidth)
+        {
+          col2 = bitmapWidth - 1;
+        }
+
+      m_columns[x].col1   = col1;
+      m_columns[x].col2   = col2;
+      m_columns[x].weight = (uint8_t)(b16frac(column) >> 8);
+    }
+
+  return true;
+}
+
+/**
+ * Interpolate part of one row of the scaled image.
+ *
+ * @param x The offset into the row to get
+ * @param y The row number to get
+ * @param width The number of pixels to get from the row
+ * @param data The memory location in which to return the data
+ * @return True if the run was returned successfully.
+ */
+
+bool CScaledBitmap::scaleRun(nxgl_coord_t x, nxgl_coord_t y,
+                             nxgl_coord_t width, FAR void *data)
 {
 #if CONFIG_NXWIDGETS_FMT == FB_FMT_RGB8_332 || CONFIG_NXWIDGETS_FMT == FB_FMT_RGB24
   FAR uint8_t  *dest = (FAR uint8_t *)data;
@@ -193,15 +430,6 @@ bool CScaledBitmap::getRun(nxgl_coord_t x, nxgl_coord_t y,
 #  error Unsupported, invalid, or undefined color format
 #endif
 
-  // Check ranges.  Casts to unsigned int are ugly but permit one-sided comparisons
-
-  if (((unsigned int)x           >=  (unsigned int)m_size.w) &&
-      ((unsigned int)(x + width) > (unsigned int)m_size.w) &&
-      ((unsigned int)y           <= (unsigned int)m_size.h))
-    {
-      return false;
-    }
-
   // Get the row number in the unscaled image corresponding to the
   // requested y position.  This must be either the exact row or the
   // closest row just before the requested position
@@ -220,117 +448,51 @@ bool CScaledBitmap::getRun(nxgl_coord_t x, nxgl_coord_t y,
       return false;
     }
 
-  // Now scale and copy the data from the cached row data
-
-  for (int i = 0; i < width; i++, x++)
-    {
-      // Get the column number in the unscaled row corresponding to the
-      // requested x position.  This must be either the exact column or the
-      // closest column just before the requested position
-
-      b16_t column = x * m_xScale;
+  // The vertical weight is the same for the whole run.  All interpolation
+  // uses 8-bit weights so that only integer multiplies are needed.
 
-      // Get the color at the position on the first row
+  unsigned int rowWeight = (unsigned int)(b16frac(row16) >> 8);
+  FAR const uint8_t *row1 = m_rowCache[0];
+  FAR const uint8_t *row2 = m_rowCache[1];
+  FAR const struct SScaledColumn *column = &m_columns[x];
 
+  for (int i = 0; i < width; i++, column++)
+    {
       struct rgbcolor_s color1;
-      if (!rowColor(m_rowCache[0], column, color1))
-        {
-          gerr("ERROR: rowColor failed for the first row\n");
-          return false;
-        }
-
-      // Get the color at the position on the first row
-
       struct rgbcolor_s color2;
-      if (!rowColor(m_rowCache[1], column, color2))
-        {
-          gerr("ERROR: rowColor failed for the second row\n");
-          return false;
-        }
-
-      // Check for transparent colors
+      struct rgbcolor_s color3;
+      struct rgbcolor_s color4;
 
-      bool transparent1;
-      bool transparent2;
+      // Interpolate between the two columns on each of the two rows
 
-#if CONFIG_NXWIDGETS_FMT == FB_FMT_RGB8_332
-      uint8_t color = RGBTO8(color1.r, color1.g, color1.b);
-      transparent1 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-      color = RGBTO8(color2.r, color2.g, color2.b);
-      transparent2 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-#elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB16_565
-      uint16_t color = RGBTO16(color1.r, color1.g, color1.b);
-      transparent1 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
+      bool transparent = unpackPixel(row1, column->col1, color1);
+      transparent     |= unpackPixel(row1, column->col2, color2);
+      interpolate(color1, color2, transparent, column->weight, color1);
 
-      color = RGBTO16(color2.r, color2.g, color2.b);
-      transparent2 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
+      transparent      = unpackPixel(row2, column->col1, color3);
+      transparent     |= unpackPixel(row2, column->col2, color4);
+      interpolate(color3, color4, transparent, column->weight, color3);
 
-#elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB24 || CONFIG_NXWIDGETS_FMT == FB_FMT_RGB32
-      uint32_t color = RGBTO24(color1.r, color1.g, color1.b);
-      transparent1 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
+      // Then interpolate between the two rows
 
-      color = RGBTO24(color2.r, color2.g, color2.b);
-      transparent2 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-#else
-#  error Unsupported, invalid, or undefined color format
-#endif
-
-      // Is one of the colors transparent?
-
-      struct rgbcolor_s scaledColor;
-      b16_t fraction b16frac(row16);
-
-      if (transparent1 || transparent2)
-        {
-          // Yes.. don't interpolate within transparent regions or
-          // between transparent and opaque regions.
-
-          // Get the color closest to the requested position
-
-          if (fraction < b16HALF)
-            {
-              scaledColor.r = color1.r;
-              scaledColor.g = color1.g;
-              scaledColor.b = color1.b;
-            }
-          else
-            {
-              scaledColor.r = color2.r;
-              scaledColor.g = color2.g;
-              scaledColor.b = color2.b;
-            }
-        }
-      else
-        {
-          // No.. both colors are opaque
-
-          if (!scaleColor(color1, color2, fraction, scaledColor))
-            {
-              return false;
-            }
-        }
+      transparent = isTransparent(color1) || isTransparent(color3);
+      interpolate(color1, color3, transparent, rowWeight, color1);
 
       // Write the interpolated data to the user buffer
 
 #if CONFIG_NXWIDGETS_FMT == FB_FMT_RGB8_332
-      color = RGBTO8(scaledColor.r, scaledColor.g, scaledColor.b);
-      *dest++ = color;
+      *dest++ = RGBTO8(color1.r, color1.g, color1.b);
 
 #elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB16_565
-      color = RGBTO16(scaledColor.r, scaledColor.g, scaledColor.b);
-      *dest++ = color;
+      *dest++ = RGBTO16(color1.r, color1.g, color1.b);
 
 #elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB24
-      *dest++ = color2.b;
-      *dest++ = color2.r;
-      *dest++ = color2.g;
+      *dest++ = color1.b;
+      *dest++ = color1.g;
+      *dest++ = color1.r;
 
 #elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB32
-      color = RGBTO24(scaledColor.r, scaledColor.g, scaledColor.b);
-      *dest++ = color;
+      *dest++ = RGBTO24(color1.r, color1.g, color1.b);
 
 #else
 #  error Unsupported, invalid, or undefined color format
@@ -340,6 +502,38 @@ bool CScaledBitmap::getRun(nxgl_coord_t x, nxgl_coord_t y,
   return true;
 }
 
+#ifdef CONFIG_NXWIDGETS_SCALEDCACHE
+/**
+ * Scale the complete image into the frame cache.
+ *
+ * @return True if the frame cache is available.
+ */
+
+bool CScaledBitmap::buildFrame(void)
+{
+  size_t stride = getStride();
+
+  m_frame = new uint8_t[stride * m_size.h];
+  if (!m_frame)
+    {
+      gerr("ERROR: Failed to allocate the scaled image\n");
+      return false;
+    }
+
+  for (nxgl_coord_t y = 0; y < m_size.h; y++)
+    {
+      if (!scaleRun(0, y, m_size.w, m_frame + y * stride))
+        {
+          delete[] m_frame;
+          m_frame = (FAR uint8_t *)0;
+          return false;
+        }
+    }
+
+  return true;
+}
+#endif
+
 /**
  * Read two rows into the row cache
  *
@@ -418,182 +612,3 @@ bool CScaledBitmap::cacheRows(unsigned int row)
 
   return true;
 }
-
-/**
- * Given an two RGB colors and a fractional value, return the scaled
- * value between the two colors.
- *
- * @param incolor1 - The first color to be used
- * @param incolor2 - The second color to be used
- * @param fraction - The fractional value
- * @param outcolor - The returned, scaled color
- */
-
-bool CScaledBitmap::scaleColor(FAR const struct rgbcolor_s &incolor1,
-                               FAR const struct rgbcolor_s &incolor2,
-                               b16_t fraction, FAR struct rgbcolor_s &outcolor)
-{
-  uint32_t component;
-  b16_t red;
-  b16_t green;
-  b16_t blue;
-
-  // A fraction of < 0.5 would mean to use use mostly color1; a fraction
-  // greater than 0.5 would men to use mostly color2
-
-  b16_t remainder = b16ONE - fraction;
-
-  // Interpolate each color value  (converting to b15)
-
-  red   = (b16_t)incolor1.r * remainder + (b16_t)incolor2.r * fraction;
-  green = (b16_t)incolor1.g * remainder + (b16_t)incolor2.g * fraction;
-  blue  = (b16_t)incolor1.b * remainder + (b16_t)incolor2.b * fraction;
-
-  // Return the integer, interpolated values, clipping to the range of
-  // uint8_t
-
-  component  = b16toi(red);
-  outcolor.r = component < 256 ? component : 255;
-
-  component  = b16toi(green);
-  outcolor.g = component < 256 ? component : 255;
-
-  component  = b16toi(blue);
-  outcolor.b = component < 256 ? component : 255;
-  return true;
-}
-
-/**
- * Given an image row and a non-integer column offset, return the
- * interpolated RGB color value corresponding to that position
- *
- * @param row - The pointer to the row in the row cache to use
- * @param column - The non-integer column offset
- * @param outcolor - The returned, interpolated color
- *
- */
-
-bool CScaledBitmap::rowColor(FAR uint8_t *row, b16_t column,
-                             FAR struct rgbcolor_s &outcolor)
-{
-  // This is the col at or just before the pixel of interest
-
-  nxgl_coord_t col1 = b16toi(column);
-  nxgl_coord_t col2 = col1 + 1;
-
-  nxgl_coord_t bitmapWidth  = m_bitmap->getWidth();
-  if (col2 >= bitmapWidth)
-    {
-      col2 = bitmapWidth - 1;
-    }
-
-  b16_t fraction = b16frac(column);
-
-  struct rgbcolor_s color1;
-  struct rgbcolor_s color2;
-
-  bool transparent1;
-  bool transparent2;
-
-#if CONFIG_NXWIDGETS_FMT == FB_FMT_RGB8_332
-  uint8_t color = row[col1];
-  color1.r = RGB8RED(color);
-  color1.g = RGB8GREEN(color);
-  color1.b = RGB8BLUE(color);
-
-  transparent1 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-  color = row[col2];
-  color2.r = RGB8RED(color);
-  color2.g = RGB8GREEN(color);
-  color2.b = RGB8BLUE(color);
-
-  transparent2 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-#elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB16_565
-  FAR uint16_t *row16 = (FAR uint16_t*)row;
-  uint16_t color = row16[col1];
-  color1.r = RGB16RED(color);
-  color1.g = RGB16GREEN(color);
-  color1.b = RGB16BLUE(color);
-
-  transparent1 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-  color = row16[col2];
-  color2.r = RGB16RED(color);
-  color2.g = RGB16GREEN(color);
-  color2.b = RGB16BLUE(color);
-
-  transparent2 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-#elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB24
-  unsigned int ndx = 3*col1;
-  color1.r = row[ndx+2];
-  color1.g = row[ndx+1];
-  color1.b = row[ndx];
-
-  uint32_t color = RGBTO24(color1.r, color1.g, color1.b);
-  transparent1 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-  ndx      = 3*col2;
-  color2.r = row[ndx+2];
-  color2.g = row[ndx+1];
-  color2.b = row[ndx];
-
-  color = RGBTO24(color2.r, color2.g, color2.b);
-  transparent2 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-#elif CONFIG_NXWIDGETS_FMT == FB_FMT_RGB32
-  FAR uint32_t *row32 = (FAR uint32_t*)row;
-  uint32_t color = row32[col1];
-  color1.r = RGB24RED(color);
-  color1.g = RGB24GREEN(color);
-  color1.b = RGB24BLUE(color);
-
-  transparent1 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-  color    = row32[col2];
-  color2.r = RGB24RED(color);
-  color2.g = RGB24GREEN(color);
-  color2.b = RGB24BLUE(color);
-
-  transparent2 = (color == CONFIG_NXWIDGETS_TRANSPARENT_COLOR);
-
-#else
-#  error Unsupported, invalid, or undefined color format
-#endif
-
-  // Is one of the colors transparent?
-
-  if (transparent1 || transparent2)
-    {
-      // Yes.. don't interpolate within transparent regions or
-      // between transparent and opaque regions.
-
-      // Return the color closest to the requested position
-      //
-      // A fraction of < 0.5 would mean to use use mostly color1; a fraction
-      // greater than 0.5 would men to use mostly color2
-
-      if (fraction < b16HALF)
-        {
-          outcolor.r = color1.r;
-          outcolor.g = color1.b;
-          outcolor.g = color1.g;
-        }
-      else
-        {
-          outcolor.r = color2.r;
-          outcolor.g = color2.b;
-          outcolor.g = color2.g;
-        }
-
-      return true;
-    }
-  else
-    {
-      // No.. both colors are opaque
-
-      return scaleColor(color1, color2, fraction, outcolor);
-    }
-}
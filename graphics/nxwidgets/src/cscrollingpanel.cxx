@@ -171,46 +171,6 @@ void CScrollingPanel::scroll(int32_t dx, int32_t dy)
 
       if (m_isContentScrolled)
         {
-          // Perform scroll
-
-          TNxArray<CRect> revealedRects;
-          CGraphicsPort *port = m_widgetControl->getGraphicsPort();
-
-          if (dx >= 0 && dy >= 0)
-            {
-              port->move(getX(), getY(), dx, dy, rect.getWidth() - dx, rect.getHeight() - dy);
-            }
-          else if (dx <= 0 && dy >= 0)
-            {
-              port->move(getX() - dx, getY(), dx, dy, rect.getWidth() + dx, rect.getHeight() - dy);
-            }
-          else if (dx >= 0 && dy <= 0)
-            {
-              port->move(getX(), getY() - dy, dx, dy, rect.getWidth() - dx, rect.getHeight() + dy);
-            }
-          else if (dx <= 0 && dy <= 0)
-            {
-              port->move(getX() - dx, getY() - dy, dx, dy, rect.getWidth() + dx, rect.getHeight() + dy);
-            }
-
-          if (dx > 0)
-            {
-              revealedRects.push_back(CRect(getX(), getY(), dx, rect.getHeight()));
-            }
-          else if (dx < 0)
-            {
-              revealedRects.push_back(CRect(getX() + rect.getWidth() + dx, getY(), -dx, rect.getHeight()));
-            }
-
-          if (dy > 0)
-            {
-              revealedRects.push_back(CRect(getX(), getY(), rect.getWidth(), dy));
-            }
-          else if (dy < 0)
-            {
-              revealedRects.push_back(CRect(getX(), getY() + rect.getHeight() + dy, rect.getWidth(), -dy));
-            }
-
           // Adjust the scroll values
 
           m_canvasY += dy;
@@ -220,35 +180,12 @@ void CScrollingPanel::scroll(int32_t dx, int32_t dy)
 
           scrollChildren(dx, dy, false);
 
-          if (revealedRects.size() > 0)
+          // Copy the pixels that remain visible and draw only the strips
+          // that the scroll revealed
+
+          if (isDrawingEnabled())
             {
-              // Draw background to revealed sections
-
-              for (int i = 0; i < revealedRects.size(); ++i)
-                {
-                  CRect &rrect = revealedRects[i];
-                  rrect.clipToIntersect(rect);
-
-                  ginfo("Redrawing %d,%d,%d,%d after scroll\n",
-                        rrect.getX(), rrect.getY(),
-                        rrect.getWidth(), rrect.getHeight());
-
-                  port->drawFilledRect(rrect.getX(), rrect.getY(),
-                                       rrect.getWidth(), rrect.getHeight(),
-                                       getBackgroundColor());
-
-                  // Check if any children intersect this region.
-                  // If it does, it should be redrawn.
-
-                  for (int j = 0; j < m_children.size(); ++j)
-                    {
-                      CRect crect = m_children[j]->getBoundingBox();
-                      if (crect.intersects(rrect))
-                        {
-                          m_children[j]->redraw();
-                        }
-                    }
-                }
+              scrollContents(dx, dy);
             }
         }
       else
@@ -269,6 +206,92 @@ void CScrollingPanel::scroll(int32_t dx, int32_t dy)
     }
 }
 
+/**
+ * Move the visible contents of the panel by the specified amounts and
+ * redraw the regions revealed by the move.  The whole panel is redrawn
+ * instead if nothing remains visible after the move or if the pixels of
+ * the panel cannot safely be copied.
+ *
+ * @param dx The horizontal distance to scroll.
+ * @param dy The vertical distance to scroll.
+ */
+
+void CScrollingPanel::scrollContents(int32_t dx, int32_t dy)
+{
+  CGraphicsPort *port = m_widgetControl->getGraphicsPort();
+
+  // Get the window-relative client area
+
+  CRect rect;
+  getRect(rect);
+
+  int32_t absDx = dx < 0 ? -dx : dx;
+  int32_t absDy = dy < 0 ? -dy : dy;
+
+  // A move would copy the pixels of any widget drawn on top of the panel,
+  // and moves are not clipped to the graphics port's clipping rectangle
+
+  if (absDx >= rect.getWidth() || absDy >= rect.getHeight() ||
+      port->isClipping() || isObscured())
+    {
+      redraw();
+      return;
+    }
+
+  // Move the part of the client area that remains visible
+
+  port->move(rect.getX() + (dx < 0 ? absDx : 0),
+             rect.getY() + (dy < 0 ? absDy : 0),
+             dx, dy, rect.getWidth() - absDx, rect.getHeight() - absDy);
+
+  // Work out which parts of the client area were revealed.  The strip
+  // revealed by the horizontal move spans the full height, so the strip
+  // revealed by the vertical move only needs to span the rest.
+
+  CRect revealed[2];
+  int nrevealed = 0;
+
+  nxgl_coord_t x     = rect.getX();
+  nxgl_coord_t width = rect.getWidth();
+
+  if (dx > 0)
+    {
+      revealed[nrevealed++] = CRect(x, rect.getY(), dx, rect.getHeight());
+      x     += dx;
+      width -= dx;
+    }
+  else if (dx < 0)
+    {
+      width -= absDx;
+      revealed[nrevealed++] = CRect(x + width, rect.getY(), absDx,
+                                    rect.getHeight());
+    }
+
+  if (dy > 0)
+    {
+      revealed[nrevealed++] = CRect(x, rect.getY(), width, dy);
+    }
+  else if (dy < 0)
+    {
+      revealed[nrevealed++] = CRect(x, rect.getY() + rect.getHeight() - absDy,
+                                    width, absDy);
+    }
+
+  // Redraw the panel and its children within each revealed strip
+
+  for (int i = 0; i < nrevealed; i++)
+    {
+      ginfo("Redrawing %d,%d,%d,%d after scroll\n",
+            revealed[i].getX(), revealed[i].getY(),
+            revealed[i].getWidth(), revealed[i].getHeight());
+
+      port->setClipRect(revealed[i]);
+      redrawRegion(revealed[i]);
+    }
+
+  port->clearClipRect();
+}
+
 /**
  * Reposition the panel's scrolling region to the specified coordinates.
  *
@@ -200,7 +200,7 @@ const CText *CScrollingTextBox::getText(void) const
 void CScrollingTextBox::setText(const CNxString &text)
 {
   m_texbox->setText(text);
-  m_scrollbar->redraw();
+  m_scrollbar->invalidate();
 }
 
 /**
@@ -213,7 +213,7 @@ void CScrollingTextBox::setText(const CNxString &text)
 void CScrollingTextBox::appendText(const CNxString &text)
 {
   m_texbox->appendText(text);
-  m_scrollbar->redraw();
+  m_scrollbar->invalidate();
 }
 
 /**
@@ -225,7 +225,7 @@ void CScrollingTextBox::appendText(const CNxString &text)
 void CScrollingTextBox::removeText(const unsigned int startIndex)
 {
   m_texbox->removeText(startIndex);
-  m_scrollbar->redraw();
+  m_scrollbar->invalidate();
 }
 
 /**
@@ -240,7 +240,7 @@ void CScrollingTextBox::removeText(const unsigned int startIndex,
                                    const unsigned int count)
 {
   m_texbox->removeText(startIndex, count);
-  m_scrollbar->redraw();
+  m_scrollbar->invalidate();
 }
 
 /**
@@ -300,7 +300,7 @@ void CScrollingTextBox::wrapCursor(bool wrap)
 void CScrollingTextBox::moveCursorToPosition(const int position)
 {
   m_texbox->moveCursorToPosition(position);
-  m_scrollbar->redraw();
+  m_scrollbar->invalidate();
 }
 
 /**
@@ -326,7 +326,7 @@ void CScrollingTextBox::insertText(const CNxString &text,
                                    const unsigned int index)
 {
   m_texbox->insertText(text, index);
-  m_scrollbar->redraw();
+  m_scrollbar->invalidate();
 }
 
 /**
@@ -338,7 +338,7 @@ void CScrollingTextBox::insertText(const CNxString &text,
 void CScrollingTextBox::insertTextAtCursor(const CNxString &text)
 {
   m_texbox->insertTextAtCursor(text);
-  m_scrollbar->redraw();
+  m_scrollbar->invalidate();
 }
 
 /**
@@ -158,7 +158,7 @@ void CSliderHorizontalGrip::drawBorder(CGraphicsPort *port)
 void CSliderHorizontalGrip::onClick(nxgl_coord_t x, nxgl_coord_t y)
 {
   startDragging(x, y);
-  redraw();
+  invalidate();
 }
 
 /**
@@ -170,7 +170,7 @@ void CSliderHorizontalGrip::onClick(nxgl_coord_t x, nxgl_coord_t y)
 
 void CSliderHorizontalGrip::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -182,7 +182,7 @@ void CSliderHorizontalGrip::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CSliderHorizontalGrip::onReleaseOutside(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
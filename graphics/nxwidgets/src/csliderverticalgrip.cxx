@@ -157,7 +157,7 @@ void CSliderVerticalGrip::drawBorder(CGraphicsPort *port)
 void CSliderVerticalGrip::onClick(nxgl_coord_t x, nxgl_coord_t y)
 {
   startDragging(x, y);
-  redraw();
+  invalidate();
 }
 
 /**
@@ -169,7 +169,7 @@ void CSliderVerticalGrip::onClick(nxgl_coord_t x, nxgl_coord_t y)
 
 void CSliderVerticalGrip::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -181,7 +181,7 @@ void CSliderVerticalGrip::onRelease(nxgl_coord_t x, nxgl_coord_t y)
 
 void CSliderVerticalGrip::onReleaseOutside(nxgl_coord_t x, nxgl_coord_t y)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -0,0 +1,429 @@
+/****************************************************************************
+ * apps/graphics/nxwidgets/src/cspancache.cxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <semaphore.h>
+#include <cerrno>
+#include <debug.h>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/cbitmap.hxx"
+#include "graphics/nxwidgets/cspancache.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Method Implementations
+ ****************************************************************************/
+
+using namespace NXWidgets;
+
+/**
+ * Constructor.
+ *
+ * @param nEntries The maximum number of span tables that will be cached.
+ * @param merge True if identical runs on adjacent rows should be merged
+ *   into rectangles.
+ */
+
+CSpanCache::CSpanCache(uint16_t nEntries, bool merge)
+{
+  m_nEntries = nEntries > 0 ? nEntries : 1;
+  m_merge    = merge;
+  m_head     = (FAR struct SSpanEntry *)0;
+  m_tail     = (FAR struct SSpanEntry *)0;
+  m_hits     = 0;
+  m_misses   = 0;
+
+  sem_init(&m_sem, 0, 1);
+
+  m_entries  = new struct SSpanEntry[m_nEntries];
+  if (!m_entries)
+    {
+      gerr("ERROR: Failed to allocate the span cache\n");
+      m_nEntries = 0;
+      return;
+    }
+
+  // Put every (empty) entry in the LRU list
+
+  for (int i = 0; i < m_nEntries; i++)
+    {
+      FAR struct SSpanEntry *entry = &m_entries[i];
+      entry->data   = (FAR const void *)0;
+      entry->spans  = (FAR struct SOpaqueSpan *)0;
+      entry->nSpans = 0;
+
+      entry->flink  = (FAR struct SSpanEntry *)0;
+      entry->blink  = m_tail;
+
+      if (m_tail)
+        {
+          m_tail->flink = entry;
+        }
+      else
+        {
+          m_head = entry;
+        }
+
+      m_tail = entry;
+    }
+}
+
+/**
+ * Destructor.
+ */
+
+CSpanCache::~CSpanCache(void)
+{
+  if (m_entries)
+    {
+      for (int i = 0; i < m_nEntries; i++)
+        {
+          freeEntry(&m_entries[i]);
+        }
+
+      delete[] m_entries;
+    }
+
+  sem_destroy(&m_sem);
+}
+
+/**
+ * Get exclusive access to the cache.
+ */
+
+void CSpanCache::lock(void)
+{
+  while (sem_wait(&m_sem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+/**
+ * Move an entry to the head of the LRU list.
+ */
+
+void CSpanCache::touchEntry(FAR struct SSpanEntry *entry)
+{
+  if (entry == m_head)
+    {
+      return;
+    }
+
+  // Remove the entry from the list
+
+  entry->blink->flink = entry->flink;
+  if (entry->flink)
+    {
+      entry->flink->blink = entry->blink;
+    }
+  else
+    {
+      m_tail = entry->blink;
+    }
+
+  // And put it back at the head
+
+  entry->blink  = (FAR struct SSpanEntry *)0;
+  entry->flink  = m_head;
+  m_head->blink = entry;
+  m_head        = entry;
+}
+
+/**
+ * Release the span table of an entry.
+ */
+
+void CSpanCache::freeEntry(FAR struct SSpanEntry *entry)
+{
+  if (entry->spans)
+    {
+      delete[] entry->spans;
+    }
+
+  entry->data   = (FAR const void *)0;
+  entry->spans  = (FAR struct SOpaqueSpan *)0;
+  entry->nSpans = 0;
+}
+
+/**
+ * Build the opaque span table of a bitmap into an entry.
+ *
+ * @param entry The entry to receive the table.
+ * @param bitmap The bitmap to scan.
+ * @param transparentColor The transparent color used in the bitmap.
+ * @return True on success; false if memory could not be allocated.
+ */
+
+bool CSpanCache::buildSpans(FAR struct SSpanEntry *entry,
+                            FAR const struct SBitmap *bitmap,
+                            nxgl_mxpixel_t transparentColor)
+{
+  nxwidget_pixel_t transparent = (nxwidget_pixel_t)transparentColor;
+
+  // First pass:  Count the runs of opaque pixels.  That is the largest
+  // number of spans that the table can hold.
+
+  unsigned int nRuns = 0;
+  FAR const uint8_t *srcLine = (FAR const uint8_t *)bitmap->data;
+
+  for (nxgl_coord_t row = 0; row < bitmap->height; row++)
+    {
+      FAR const nxwidget_pixel_t *srcPtr = (FAR const nxwidget_pixel_t *)srcLine;
+      bool opaque = false;
+
+      for (nxgl_coord_t col = 0; col < bitmap->width; col++)
+        {
+          bool isOpaque = (srcPtr[col] != transparent);
+          if (isOpaque && !opaque)
+            {
+              nRuns++;
+            }
+
+          opaque = isOpaque;
+        }
+
+      srcLine += bitmap->stride;
+    }
+
+  FAR struct SOpaqueSpan *spans = (FAR struct SOpaqueSpan *)0;
+  FAR unsigned int *prevRow     = (FAR unsigned int *)0;
+  FAR unsigned int *thisRow     = (FAR unsigned int *)0;
+
+  if (nRuns > 0)
+    {
+      spans = new struct SOpaqueSpan[nRuns];
+
+      // When merging, keep the indices of the spans that end on the
+      // previous row and on this row.  There can be no more than
+      // (width + 1) / 2 runs on a row.
+
+      if (m_merge)
+        {
+          unsigned int maxRuns = (bitmap->width + 1) / 2;
+          prevRow = new unsigned int[maxRuns];
+          thisRow = new unsigned int[maxRuns];
+        }
+
+      if (!spans || (m_merge && (!prevRow || !thisRow)))
+        {
+          gerr("ERROR: Failed to allocate %u spans\n", nRuns);
+
+          delete[] spans;
+          delete[] prevRow;
+          delete[] thisRow;
+          return false;
+        }
+    }
+
+  // Second pass: Record the runs.  When merging, a run that exactly
+  // matches a span that ended on the previous row extends that span
+  // downward instead of starting a new one.  Both lists are ordered by
+  // column.
+
+  unsigned int nSpans = 0;
+  unsigned int nPrev  = 0;
+
+  srcLine = (FAR const uint8_t *)bitmap->data;
+  for (nxgl_coord_t row = 0; row < bitmap->height; row++)
+    {
+      FAR const nxwidget_pixel_t *srcPtr = (FAR const nxwidget_pixel_t *)srcLine;
+      unsigned int candidate = 0;
+      unsigned int nThis     = 0;
+      nxgl_coord_t col       = 0;
+
+      while (col < bitmap->width)
+        {
+          // Skip over transparent pixels
+
+          while (col < bitmap->width && srcPtr[col] == transparent)
+            {
+              col++;
+            }
+
+          if (col >= bitmap->width)
+            {
+              break;
+            }
+
+          // Find the end of the opaque run
+
+          nxgl_coord_t runX = col;
+          while (col < bitmap->width && srcPtr[col] != transparent)
+            {
+              col++;
+            }
+
+          nxgl_coord_t runWidth = col - runX;
+
+          if (m_merge)
+            {
+              // Look for a matching span that ended on the previous row
+
+              while (candidate < nPrev && spans[prevRow[candidate]].x < runX)
+                {
+                  candidate++;
+                }
+
+              if (candidate < nPrev && spans[prevRow[candidate]].x == runX &&
+                  spans[prevRow[candidate]].width == runWidth)
+                {
+                  spans[prevRow[candidate]].height++;
+                  thisRow[nThis++] = prevRow[candidate++];
+                  continue;
+                }
+
+              thisRow[nThis++] = nSpans;
+            }
+
+          spans[nSpans].x      = runX;
+          spans[nSpans].y      = row;
+          spans[nSpans].width  = runWidth;
+          spans[nSpans].height = 1;
+          nSpans++;
+        }
+
+      if (m_merge)
+        {
+          FAR unsigned int *tmp = prevRow;
+          prevRow = thisRow;
+          thisRow = tmp;
+          nPrev   = nThis;
+        }
+
+      srcLine += bitmap->stride;
+    }
+
+  delete[] prevRow;
+  delete[] thisRow;
+
+  entry->data        = bitmap->data;
+  entry->spans       = spans;
+  entry->nSpans      = nSpans;
+  entry->width       = bitmap->width;
+  entry->height      = bitmap->height;
+  entry->stride      = bitmap->stride;
+  entry->transparent = transparentColor;
+  return true;
+}
+
+/**
+ * Return the opaque span table of a bitmap, building it if necessary.
+ *
+ * @param bitmap The bitmap.
+ * @param transparentColor The transparent color used in the bitmap.
+ * @param spans The location to return the span table.
+ * @param nSpans The location to return the number of spans.
+ * @return True if the table is available; false if it could not be built.
+ */
+
+bool CSpanCache::getSpans(FAR const struct SBitmap *bitmap,
+                          nxgl_mxpixel_t transparentColor,
+                          FAR const struct SOpaqueSpan **spans,
+                          FAR unsigned int *nSpans)
+{
+  if (m_nEntries == 0)
+    {
+      return false;
+    }
+
+  // Search for the bitmap
+
+  FAR struct SSpanEntry *entry;
+  for (entry = m_head; entry; entry = entry->flink)
+    {
+      if (entry->data == bitmap->data &&
+          entry->width == bitmap->width &&
+          entry->height == bitmap->height &&
+          entry->stride == bitmap->stride &&
+          entry->transparent == transparentColor)
+        {
+          break;
+        }
+    }
+
+  if (entry)
+    {
+      m_hits++;
+    }
+  else
+    {
+      // Re-use the least recently used entry
+
+      m_misses++;
+
+      entry = m_tail;
+      freeEntry(entry);
+
+      if (!buildSpans(entry, bitmap, transparentColor))
+        {
+          return false;
+        }
+    }
+
+  touchEntry(entry);
+
+  *spans  = entry->spans;
+  *nSpans = entry->nSpans;
+  return true;
+}
+
+/**
+ * Discard any span tables built for a bitmap.
+ *
+ * @param bitmap The bitmap whose span tables are discarded.
+ */
+
+void CSpanCache::invalidate(FAR const struct SBitmap *bitmap)
+{
+  for (int i = 0; i < m_nEntries; i++)
+    {
+      if (m_entries[i].data == bitmap->data)
+        {
+          freeEntry(&m_entries[i]);
+        }
+    }
+}
+
+/**
+ * Discard all cached span tables.  The statistics are not affected.
+ */
+
+void CSpanCache::flush(void)
+{
+  for (int i = 0; i < m_nEntries; i++)
+    {
+      freeEntry(&m_entries[i]);
+    }
+}
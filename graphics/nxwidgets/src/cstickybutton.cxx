@@ -112,7 +112,7 @@ CStickyButton::CStickyButton(CWidgetControl *pWidgetControl,
 void CStickyButton::setStuckDown(bool stuckDown)
   {
     m_isStuckDown = stuckDown;
-    redraw();
+    invalidate();
   }
 
 /**
@@ -147,7 +147,7 @@ bool CStickyButtonArray::stickDown(int column, int row)
       // We only want to update the stuck down buttons
 
       m_stickDown    = true;
-      redraw();
+      invalidate();
       m_stickDown    = false;
       return true;
     }
@@ -172,7 +172,7 @@ void CStickyButtonArray::unstick(void)
       // We only want to update the stuck down buttons
 
       m_stickDown   = true;
-      redraw();
+      invalidate();
       m_stickDown   = false;
    }
 }
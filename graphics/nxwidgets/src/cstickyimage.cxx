@@ -75,7 +75,7 @@ CStickyImage::CStickyImage(CWidgetControl *pWidgetControl,
 void CStickyImage::setStuckSelection(bool selection)
 {
   m_stuckSelection = selection;
-  redraw();
+  invalidate();
 }
 
 /**
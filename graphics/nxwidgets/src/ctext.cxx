@@ -85,9 +85,13 @@ using namespace NXWidgets;
 CText::CText(CNxFont *font, const CNxString &text, nxgl_coord_t width)
 : CNxString(text)
 {
-  m_font        = font;
-  m_width       = width;
-  m_lineSpacing = 1;
+  m_font         = font;
+  m_width        = width;
+  m_lineSpacing  = 1;
+  m_firstLine    = 0;
+  m_firstLongest = 0;
+  m_charBase     = 0;
+  m_longestStale = false;
   wrap();
 }
 
@@ -226,10 +230,10 @@ const int CText::getLineLength(const int lineNumber) const
 {
   if (lineNumber < getLineCount() - 1)
     {
-      return m_linePositions[lineNumber + 1] - m_linePositions[lineNumber];
+      return getLineStartIndex(lineNumber + 1) - getLineStartIndex(lineNumber);
     }
 
-  return getLength() - m_linePositions[lineNumber];
+  return getLength() - getLineStartIndex(lineNumber);
 }
 
 /**
@@ -250,7 +254,7 @@ const int CText::getLineTrimmedLength(const int lineNumber) const
 
   // Get char at the end of the line
 
-  if (iterator->moveTo(m_linePositions[lineNumber] + length - 1))
+  if (iterator->moveTo(getLineStartIndex(lineNumber) + length - 1))
     {
       do
         {
@@ -318,22 +322,47 @@ CNxFont *CText::getFont(void) const
 
 void CText::stripTopLines(const int lines)
 {
-  // Get the start point of the text we want to keep
+  if (lines <= 0)
+    {
+      return;
+    }
 
-  nxgl_coord_t textStart = 0;
+  // Removing every line leaves no wrapping data worth keeping
 
-  for (int i = 0; i < lines; i++)
+  if (lines >= getLineCount())
     {
-      textStart += getLineLength(i);
+      CNxString::remove(0);
+      wrap();
+      return;
     }
 
-  // Remove the characters from the start of the string to the found location
+  // Remove the characters from the start of the string to the start of the
+  // first line that we want to keep.  The remaining lines are unchanged, so
+  // the existing line positions just need to be offset rather than rebuilt.
 
-  remove(0, textStart);
+  int textStart = getLineStartIndex(lines);
+  CNxString::remove(0, textStart);
 
-  // Rewrap the text
+  m_charBase  += textStart;
+  m_firstLine += lines;
 
-  wrap();
+  // Forget any longest line records for the removed lines
+
+  if (m_longestStale)
+    {
+      rebuildLongestLines();
+    }
+  else
+    {
+      while (m_firstLongest < m_longestLines.size() &&
+             m_longestLines[m_firstLongest] < m_firstLine)
+        {
+          m_firstLongest++;
+        }
+    }
+
+  updatePixelSize();
+  compactLines();
 }
 
 /**
@@ -361,7 +390,7 @@ void CText::wrap(int charIndex)
   int breakIndex;
   bool endReached = false;
 
-  if (m_linePositions.size() == 0)
+  if (getLinePositionCount() == 0)
     {
       charIndex = 0;
     }
@@ -371,64 +400,25 @@ void CText::wrap(int charIndex)
 
   if (charIndex > 0)
     {
-      // Remove wrapping data past this point
-
-      // Get the index of the line in which the char index appears
+      // Remove wrapping data from the line in which the char index appears
+      // onwards, then adjust start position of wrapping loop so that it
+      // starts with that line
 
       int lineIndex = getLineContainingCharIndex(charIndex);
-
-      // Remove any longest line records that occur from the line index onwards
-
-      while ((m_longestLines.size() > 0) &&
-             (m_longestLines[m_longestLines.size() - 1].index >= lineIndex))
-        {
-          m_longestLines.pop_back();
-        }
-
-      // If there are any longest line records remaining, update the text pixel width
-      // The last longest line record will always be the last valid longest line as
-      // the vector is sorted by length
-
-      if (m_longestLines.size() > 0)
-        {
-          m_textPixelWidth = m_longestLines[m_longestLines.size() - 1].width;
-        }
-      else
-        {
-          m_textPixelWidth = 0;
-        }
-
-      // Remove any wrapping data from after this line index onwards
-
-      while ((m_linePositions.size() > 0) &&
-             (m_linePositions.size() - 1 > (int)lineIndex))
-       {
-          m_linePositions.pop_back();
-        }
-
-      // Adjust start position of wrapping loop so that it starts with
-      // the current line index
-
-      if (m_linePositions.size() > 0)
-        {
-          pos = m_linePositions[m_linePositions.size() - 1];
-        }
+      truncateLines(lineIndex);
+      pos = getLineStartIndex(lineIndex);
     }
   else
     {
       // Remove all wrapping data
 
-      // Wipe the width variable
-
-      m_textPixelWidth = 0;
-
-      // Empty existing longest lines
-
-      m_longestLines.clear();
-
-      // Empty existing line positions
-
       m_linePositions.clear();
+      m_lineWidths.clear();
+      m_longestLines.clear();
+      m_firstLine    = 0;
+      m_firstLongest = 0;
+      m_charBase     = 0;
+      m_longestStale = false;
 
       // Push first line start into vector
 
@@ -532,54 +522,28 @@ void CText::wrap(int charIndex)
           // Add the start of the next line to the vector
 
           pos = breakIndex + 1;
-          m_linePositions.push_back(pos);
-
-          // Is this the longest line observed so far?
-
-          if (lineWidth > m_textPixelWidth)
-            {
-              m_textPixelWidth = lineWidth;
-
-              // Push the description of the line into the longest lines
-              // vector (note that we store the index in m_linePositions that
-              // refers to the start of the line, *not* the position of the
-              // line in the char array)
-
-              LongestLine line;
-              line.index = m_linePositions.size() - 2;
-              line.width = lineWidth;
-              m_longestLines.push_back(line);
-            }
+          pushLine(pos, lineWidth);
         }
       else if (!endReached)
         {
           // Add a blank row if we're not at the end of the string
 
           pos++;
-          m_linePositions.push_back(pos);
+          pushLine(pos, 0);
         }
     }
 
   // Add marker indicating end of text
   // If we reached the end of the text, append the stopping point
 
-  if ((unsigned int)m_linePositions[m_linePositions.size() - 1] != getLength() + 1)
+  if ((unsigned int)getLineStartIndex(getLinePositionCount() - 1) != getLength() + 1)
     {
-      m_linePositions.push_back(getLength());
+      pushLine(getLength(), 0);
     }
 
   delete iterator;
 
-  // Calculate the total height of the text
-
-  m_textPixelHeight = getLineCount() * (m_font->getHeight() + m_lineSpacing);
-
-  // Ensure height is always at least one row
-
-  if (m_textPixelHeight == 0)
-    {
-      m_textPixelHeight = m_font->getHeight() + m_lineSpacing;
-    }
+  updatePixelSize();
 }
 
 /**
@@ -595,22 +559,22 @@ const int CText::getLineContainingCharIndex(const int index) const
 {
   // Early exit if there is no existing line data
 
-  if (m_linePositions.size() == 0)
+  if (getLinePositionCount() == 0)
     {
       return 0;
     }
 
   // Early exit if the character is in the last row
 
-  if (index >= m_linePositions[m_linePositions.size() - 2])
+  if (index >= getLineStartIndex(getLinePositionCount() - 2))
     {
-      return m_linePositions.size() - 2;
+      return getLinePositionCount() - 2;
     }
 
   // Binary search the line vector for the line containing the supplied index
 
   int bottom = 0;
-  int top = m_linePositions.size() - 1;
+  int top = getLinePositionCount() - 1;
   int mid;
 
   while (bottom <= top)
@@ -619,19 +583,19 @@ const int CText::getLineContainingCharIndex(const int index) const
 
       mid = (bottom + top) >> 1;
 
-      if (index < m_linePositions[mid])
+      if (index < getLineStartIndex(mid))
         {
           // Index is somewhere in the lower search space
 
           top = mid - 1;
         }
-      else if (index > m_linePositions[mid])
+      else if (index > getLineStartIndex(mid))
         {
           // Index is somewhere in the upper search space
 
           bottom = mid + 1;
         }
-      else if (index == m_linePositions[mid])
+      else if (index == getLineStartIndex(mid))
         {
           // Located the index
 
@@ -641,15 +605,15 @@ const int CText::getLineContainingCharIndex(const int index) const
       // Check to see if we've moved past the line that contains the index
       // We have to do this because the index we're looking for can be within
       // a line; it isn't necessarily the start of a line (which is what is
-      // stored in the m_linePositions vector)
+      // stored in the line positions vector)
 
-      if (index > m_linePositions[top])
+      if (index > getLineStartIndex(top))
         {
           // Search index falls within the line represented by the top position
 
           return top;
         }
-      else if (index < m_linePositions[bottom])
+      else if (index < getLineStartIndex(bottom))
         {
           // Search index falls within the line represented by the bottom position
 
@@ -661,3 +625,183 @@ const int CText::getLineContainingCharIndex(const int index) const
 
   return 0;
 }
+
+/**
+ * Record the start of a new line.
+ *
+ * @param pos The char index of the start of the line.
+ * @param width The width of the preceding line in pixels.
+ */
+
+void CText::pushLine(int pos, nxgl_coord_t width)
+{
+  m_linePositions.push_back(pos + m_charBase);
+  m_lineWidths.push_back(width);
+  addLongestLine(m_lineWidths.size() - 1);
+}
+
+/**
+ * Add a line to the end of the longest line data.
+ *
+ * @param line The index of the line in m_lineWidths.
+ */
+
+void CText::addLongestLine(int line)
+{
+  nxgl_coord_t width = m_lineWidths[line];
+
+  if (width > 0)
+    {
+      // Lines that are no wider than this one cannot be the longest line
+      // while this line remains
+
+      while (m_longestLines.size() > m_firstLongest &&
+             m_lineWidths[m_longestLines[m_longestLines.size() - 1]] <= width)
+        {
+          m_longestLines.pop_back();
+        }
+
+      m_longestLines.push_back(line);
+    }
+}
+
+/**
+ * Discard the wrapping data for the specified line and all lines after
+ * it.
+ *
+ * @param line The first line to discard.
+ */
+
+void CText::truncateLines(int line)
+{
+  int first = m_firstLine + line;
+
+  // Remove any longest line records that occur from the line onwards.  The
+  // first remaining record is still the longest line, but the lines that
+  // the removed records replaced are no longer known.
+
+  while (m_longestLines.size() > m_firstLongest &&
+         m_longestLines[m_longestLines.size() - 1] >= first)
+    {
+      m_longestLines.pop_back();
+      m_longestStale = true;
+    }
+
+  while (m_linePositions.size() > first + 1)
+    {
+      m_linePositions.pop_back();
+    }
+
+  while (m_lineWidths.size() > first)
+    {
+      m_lineWidths.pop_back();
+    }
+
+  // If no records remain, the longest of the remaining lines is unknown
+
+  if (m_longestStale && m_longestLines.size() == m_firstLongest)
+    {
+      rebuildLongestLines();
+    }
+}
+
+/**
+ * Rebuild the longest line data from the recorded line widths.
+ */
+
+void CText::rebuildLongestLines(void)
+{
+  m_longestLines.clear();
+  m_firstLongest = 0;
+  m_longestStale = false;
+
+  for (int i = m_firstLine; i < m_lineWidths.size(); i++)
+    {
+      addLongestLine(i);
+    }
+}
+
+/**
+ * Update the text pixel width and height from the wrapping data.
+ */
+
+void CText::updatePixelSize(void)
+{
+  // The first longest line record is the longest line
+
+  if (m_longestLines.size() > m_firstLongest)
+    {
+      m_textPixelWidth = m_lineWidths[m_longestLines[m_firstLongest]];
+    }
+  else
+    {
+      m_textPixelWidth = 0;
+    }
+
+  // Calculate the total height of the text
+
+  m_textPixelHeight = getLineCount() * (m_font->getHeight() + m_lineSpacing);
+
+  // Ensure height is always at least one row
+
+  if (m_textPixelHeight == 0)
+    {
+      m_textPixelHeight = m_font->getHeight() + m_lineSpacing;
+    }
+}
+
+/**
+ * Release the array entries that describe stripped lines once they
+ * make up most of the arrays.
+ */
+
+void CText::compactLines(void)
+{
+  // Compacting costs one pass over the remaining lines, so waiting until
+  // the stripped lines outnumber the remaining lines keeps the cost of
+  // stripping each line constant
+
+  if (m_firstLine < CONFIG_NXWIDGETS_TNXARRAY_SIZEINCREMENT ||
+      m_firstLine < getLinePositionCount())
+    {
+      return;
+    }
+
+  int count = getLinePositionCount();
+
+  for (int i = 0; i < count; i++)
+    {
+      m_linePositions[i] = m_linePositions[m_firstLine + i] - m_charBase;
+    }
+
+  for (int i = 0; i < count - 1; i++)
+    {
+      m_lineWidths[i] = m_lineWidths[m_firstLine + i];
+    }
+
+  while (m_linePositions.size() > count)
+    {
+      m_linePositions.pop_back();
+    }
+
+  while (m_lineWidths.size() > count - 1)
+    {
+      m_lineWidths.pop_back();
+    }
+
+  int nlongest = m_longestLines.size() - m_firstLongest;
+
+  for (int i = 0; i < nlongest; i++)
+    {
+      m_longestLines[i] = m_longestLines[m_firstLongest + i] - m_firstLine;
+    }
+
+  while (m_longestLines.size() > nlongest)
+    {
+      m_longestLines.pop_back();
+    }
+
+  m_firstLine    = 0;
+  m_firstLongest = 0;
+  m_charBase     = 0;
+}
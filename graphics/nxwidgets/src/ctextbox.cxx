@@ -135,7 +135,7 @@ void CTextBox::showCursor(EShowCursor cursorMode)
   if (m_showCursor != cursorMode)
     {
       m_showCursor = cursorMode;
-      redraw();
+      invalidate();
     }
 }
 
@@ -232,7 +232,7 @@ void CTextBox::moveCursorToPosition(const int position)
   if (repositionCursor(position))
     {
       calculateTextPositionHorizontal();
-      redraw();
+      invalidate();
     }
 }
 
@@ -308,7 +308,7 @@ void CTextBox::handleCursorControlEvent(const CWidgetEventArgs &e)
 
 void CTextBox::onBlur(void)
 {
-  redraw();
+  invalidate();
 }
 
 /**
@@ -0,0 +1,298 @@
+/****************************************************************************
+ * apps/graphics/nxwidgets/src/ctimerqueue.cxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <semaphore.h>
+#include <cstring>
+#include <cerrno>
+#include <debug.h>
+
+#include <nuttx/clock.h>
+#include <nuttx/wqueue.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/cnxtimer.hxx"
+#include "graphics/nxwidgets/cwidgeteventhandlerlist.hxx"
+#include "graphics/nxwidgets/ctimerqueue.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/* Deadlines are aligned to multiples of this many ticks */
+
+#define TIMERQUEUE_SLACK_TICKS \
+  (CONFIG_NXWIDGETS_TIMERQUEUE_SLACK >= MSEC_PER_TICK ? \
+   CONFIG_NXWIDGETS_TIMERQUEUE_SLACK / MSEC_PER_TICK : 1)
+
+/****************************************************************************
+ * Method Implementations
+ ****************************************************************************/
+
+using namespace NXWidgets;
+
+/**
+ * Constructor.
+ */
+
+CTimerQueue::CTimerQueue(void)
+{
+  m_scheduled = 0;
+  m_isQueued  = false;
+
+  memset(&m_work, 0, sizeof(m_work));
+  sem_init(&m_sem, 0, 1);
+}
+
+/**
+ * Destructor.  Cancels the work queue entry.
+ */
+
+CTimerQueue::~CTimerQueue(void)
+{
+  lock();
+
+  if (m_isQueued)
+    {
+      work_cancel(USRWORK, &m_work);
+      m_isQueued = false;
+    }
+
+  unlock();
+  sem_destroy(&m_sem);
+}
+
+/**
+ * Get exclusive access to the queue.
+ */
+
+void CTimerQueue::lock(void)
+{
+  while (sem_wait(&m_sem) < 0)
+    {
+      DEBUGASSERT(errno == EINTR);
+    }
+}
+
+/**
+ * Add a timer to the queue in order of its deadline.  The caller must
+ * hold the lock.
+ *
+ * @param timer The timer to add.
+ * @param now The current system time in ticks.
+ */
+
+void CTimerQueue::insertTimer(CNxTimer *timer, clock_t now)
+{
+  // Round the deadline up so that timers that expire at about the same
+  // time share one wake-up.  Always wait at least one tick.
+
+  clock_t ticks = timer->m_timeout / MSEC_PER_TICK;
+  if (ticks < 1)
+    {
+      ticks = 1;
+    }
+
+  clock_t deadline = now + ticks + TIMERQUEUE_SLACK_TICKS - 1;
+  deadline -= deadline % TIMERQUEUE_SLACK_TICKS;
+
+  timer->m_deadline  = deadline;
+  timer->m_isRunning = true;
+
+  // Find the first timer with a later deadline.  Timers with the same
+  // deadline fire in the order that they were started.
+
+  int lower = 0;
+  int upper = m_timers.size();
+
+  while (lower < upper)
+    {
+      int middle = (lower + upper) >> 1;
+      if ((sclock_t)(m_timers[middle]->m_deadline - deadline) <= 0)
+        {
+          lower = middle + 1;
+        }
+      else
+        {
+          upper = middle;
+        }
+    }
+
+  m_timers.insert(lower, timer);
+}
+
+/**
+ * Queue the work for the earliest deadline, or cancel it if no timers are
+ * running.  The caller must hold the lock.
+ *
+ * @param now The current system time in ticks.
+ */
+
+void CTimerQueue::schedule(clock_t now)
+{
+  if (m_timers.size() < 1)
+    {
+      if (m_isQueued)
+        {
+          work_cancel(USRWORK, &m_work);
+          m_isQueued = false;
+        }
+
+      return;
+    }
+
+  // Nothing to do if the work is already queued for the earliest deadline
+
+  clock_t deadline = m_timers[0]->m_deadline;
+  if (m_isQueued && m_scheduled == deadline)
+    {
+      return;
+    }
+
+  if (m_isQueued)
+    {
+      work_cancel(USRWORK, &m_work);
+    }
+
+  sclock_t delay = (sclock_t)(deadline - now);
+  if (delay < 0)
+    {
+      delay = 0;
+    }
+
+  int ret = work_queue(USRWORK, &m_work, workQueueCallback, this, delay);
+  if (ret < 0)
+    {
+      gerr("ERROR: work_queue failed: %d\n", ret);
+      m_isQueued = false;
+      return;
+    }
+
+  m_scheduled = deadline;
+  m_isQueued  = true;
+}
+
+/**
+ * Static function called from the work queue when the earliest deadline
+ * expires.
+ *
+ * @param arg Pointer to the CTimerQueue instance.
+ */
+
+void CTimerQueue::workQueueCallback(FAR void *arg)
+{
+  CTimerQueue *This = (CTimerQueue *)arg;
+  clock_t now = clock_systime_ticks();
+
+  This->lock();
+  This->m_isQueued = false;
+
+  // Fire each expired timer.  The lock is released while the action
+  // event is raised, so the queue is re-examined for each timer in case
+  // an event handler started or stopped timers.
+
+  while (This->m_timers.size() > 0 &&
+         (sclock_t)(This->m_timers[0]->m_deadline - now) <= 0)
+    {
+      CNxTimer *timer = This->m_timers[0];
+      This->m_timers.erase(0);
+      timer->m_isRunning = false;
+
+      // Restart the timer if this is a repeating timer
+
+      if (timer->m_isRepeater)
+        {
+          This->insertTimer(timer, now);
+        }
+
+      This->unlock();
+
+      // Raise the action event
+
+      timer->m_widgetEventHandlers->raiseActionEvent();
+
+      This->lock();
+    }
+
+  // Wait for the next deadline
+
+  This->schedule(now);
+  This->unlock();
+}
+
+/**
+ * Start a timer.  The timer fires after its timeout.
+ *
+ * @param timer The timer to start.
+ */
+
+void CTimerQueue::startTimer(CNxTimer *timer)
+{
+  lock();
+
+  if (!timer->m_isRunning)
+    {
+      clock_t now = clock_systime_ticks();
+      insertTimer(timer, now);
+      schedule(now);
+    }
+
+  unlock();
+}
+
+/**
+ * Stop a timer.  Does nothing if the timer is not running.
+ *
+ * @param timer The timer to stop.
+ */
+
+void CTimerQueue::stopTimer(CNxTimer *timer)
+{
+  lock();
+
+  if (timer->m_isRunning)
+    {
+      for (int i = 0; i < m_timers.size(); i++)
+        {
+          if (m_timers[i] == timer)
+            {
+              m_timers.erase(i);
+              break;
+            }
+        }
+
+      timer->m_isRunning = false;
+
+      // The work is left queued for the old deadline if it is still the
+      // earliest.  Otherwise it is re-queued or cancelled.
+
+      schedule(clock_systime_ticks());
+    }
+
+  unlock();
+}
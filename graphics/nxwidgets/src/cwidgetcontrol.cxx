@@ -32,6 +32,9 @@
 #include <debug.h>
 #include <sched.h>
 
+#include <nuttx/clock.h>
+#include <nuttx/wqueue.h>
+
 #include "graphics/nxwidgets/nxconfig.hxx"
 #include "graphics/nxwidgets/cnxserver.hxx"
 #include "graphics/nxwidgets/cnxwidget.hxx"
@@ -39,6 +42,7 @@
 #include "graphics/nxwidgets/cwidgetstyle.hxx"
 #include "graphics/nxwidgets/cnxtimer.hxx"
 #include "graphics/nxwidgets/cgraphicsport.hxx"
+#include "graphics/nxwidgets/cbufferedwindow.hxx"
 #include "graphics/nxwidgets/cwidgetcontrol.hxx"
 #include "graphics/nxwidgets/singletons.hxx"
 
@@ -66,6 +70,9 @@ using namespace NXWidgets;
  */
 
 CWidgetControl::CWidgetControl(FAR const CWidgetStyle *style)
+#ifdef CONFIG_NXWIDGETS_DAMAGE
+: m_damage(CONFIG_NXWIDGETS_DAMAGE_NRECTS)
+#endif
 {
   // Initialize state
 
@@ -73,6 +80,11 @@ CWidgetControl::CWidgetControl(FAR const CWidgetStyle *style)
   m_haveGeometry       = false;
   m_clickedWidget      = NULL;
   m_focusedWidget      = NULL;
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+  m_window             = NULL;
+  m_backBuffer         = NULL;
+  m_doubleBuffered     = false;
+#endif
 
   // Initialize data that we will get from the position callback
 
@@ -90,6 +102,21 @@ CWidgetControl::CWidgetControl(FAR const CWidgetStyle *style)
 
 #ifdef CONFIG_NX_XYINPUT
   memset(&m_xyinput, 0, sizeof(struct SXYInput));
+#endif
+#ifdef CONFIG_NXWIDGETS_XYQUEUE
+  m_xyhead             = 0;
+  m_xycount            = 0;
+  m_xybuttons          = 0;
+  m_xyMerged           = 0;
+  m_xyDropped          = 0;
+  m_xyDragTime.tv_sec  = 0;
+  m_xyDragTime.tv_nsec = 0;
+#ifdef NXWIDGETS_XYQUEUE_REPOLL
+  memset(&m_xyWork, 0, sizeof(struct work_s));
+  m_xyWorkPending      = 0;
+  m_xyWorkWaiting      = false;
+  sem_init(&m_xyWorkSem, 0, 0);
+#endif
 #endif
   m_nCh                = 0;
   m_nCc                = 0;
@@ -137,6 +164,27 @@ CWidgetControl::~CWidgetControl(void)
   postWindowEvent();
 #endif
 
+#ifdef NXWIDGETS_XYQUEUE_REPOLL
+  // Make sure that no re-poll runs after we are gone.  work_cancel() does
+  // not wait for a callback that has already been taken from the queue, so
+  // wait for the callback to finish.
+
+  sched_lock();
+  if (work_cancel(USRWORK, &m_xyWork) == OK)
+    {
+      m_xyWorkPending--;
+    }
+
+  while (m_xyWorkPending > 0)
+    {
+      m_xyWorkWaiting = true;
+      sem_wait(&m_xyWorkSem);
+    }
+
+  sched_unlock();
+  sem_destroy(&m_xyWorkSem);
+#endif
+
   // Delete any contained instances
 
   if (m_port)
@@ -144,6 +192,13 @@ CWidgetControl::~CWidgetControl(void)
       delete m_port;
     }
 
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+  if (m_backBuffer)
+    {
+      delete m_backBuffer;
+    }
+#endif
+
   // Flush the delete queue
 
   processDeleteQueue();
@@ -218,6 +273,7 @@ void CWidgetControl::postWindowEvent(void)
  *   pollMouseEvents(widget)
  *   pollKeyboardEvents()
  *   pollCursorControlEvents()
+ *   processDamage() (if CONFIG_NXWIDGETS_DAMAGE is defined)
  *
  * @param widget.  Specific widget to poll.  Use NULL to run the
  *    all widgets in the window.
@@ -241,7 +297,25 @@ bool CWidgetControl::pollEvents(CNxWidget *widget)
   // Handle cursor control input
 
   bool cursorControlEvent = pollCursorControlEvents();
+
+#ifdef CONFIG_NXWIDGETS_DAMAGE
+  // Redraw whatever was invalidated by the events (or since the last poll)
+
+  bool damageEvent = processDamage();
+#endif
+
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+  // This is the end of the frame.  Send everything that was drawn in the
+  // back buffer to the window.
+
+  flushBackBuffer();
+#endif
+
+#ifdef CONFIG_NXWIDGETS_DAMAGE
+  return mouseEvent || keyboardEvent || cursorControlEvent || damageEvent;
+#else
   return mouseEvent || keyboardEvent || cursorControlEvent;
+#endif
 }
 
 /**
@@ -301,6 +375,31 @@ void CWidgetControl::addToDeleteQueue(CNxWidget *widget)
 #endif
 }
 
+/**
+ * Mark a region of the window as needing to be redrawn.
+ *
+ * @param rect The window-relative region to be redrawn.
+ */
+
+void CWidgetControl::invalidate(const CRect &rect)
+{
+#ifdef CONFIG_NXWIDGETS_DAMAGE
+  // The damage list may be updated from other threads
+
+  sched_lock();
+  m_damage.addRect(rect);
+  sched_unlock();
+
+  // Then wake up logic that may be waiting for a window event
+
+#ifdef CONFIG_NXWIDGET_EVENTWAIT
+  postWindowEvent();
+#endif
+#else
+  redrawRegion(rect);
+#endif
+}
+
 /**
  * Set the clicked widget pointer.  Note that this should not be
  * called by code other than within the CWidgetControl library itself.
@@ -344,6 +443,78 @@ void CWidgetControl::setFocusedWidget(CNxWidget *widget)
     }
 }
 
+/**
+ * Redraw the top-level widgets that intersect a region of the window,
+ * with drawing clipped to that region.
+ *
+ * @param rect The window-relative region to redraw.
+ */
+
+void CWidgetControl::redrawRegion(const CRect &rect)
+{
+  if (m_port == NULL)
+    {
+      return;
+    }
+
+  m_port->setClipRect(rect);
+
+  // Child widgets are reached through their parents
+
+  for (int i = 0; i < m_widgets.size(); i++)
+    {
+      CNxWidget *widget = m_widgets[i];
+      if (widget->getParent() == NULL)
+        {
+          widget->redrawRegion(rect);
+        }
+    }
+
+  m_port->clearClipRect();
+}
+
+#ifdef CONFIG_NXWIDGETS_DAMAGE
+/**
+ * Redraw the parts of the window that have been invalidated since the
+ * last call.
+ *
+ * @return True means that some part of the window was redrawn
+ */
+
+bool CWidgetControl::processDamage(void)
+{
+  if (m_damage.isEmpty() || m_port == NULL)
+    {
+      return false;
+    }
+
+  // Take the current damage list.  Widgets may invalidate themselves
+  // again while they are being redrawn; that damage is handled on the
+  // next poll.
+
+  CRect damage[CONFIG_NXWIDGETS_DAMAGE_NRECTS];
+
+  sched_lock();
+  int nDamage = m_damage.getRectCount();
+  for (int i = 0; i < nDamage; i++)
+    {
+      damage[i] = m_damage.getRect(i);
+    }
+
+  m_damage.clear();
+  sched_unlock();
+
+  // Redraw each damaged region
+
+  for (int i = 0; i < nDamage; i++)
+    {
+      redrawRegion(damage[i]);
+    }
+
+  return true;
+}
+#endif
+
 /**
  * This event is called from CCallback instance to provide
  * notifications of certain NX-server related events. This event,
@@ -405,6 +576,15 @@ void CWidgetControl::geometryEvent(NXHANDLE hWindow,
       giveGeoSem();
     }
 
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+  // The back buffer must follow the size of the window
+
+  if (m_backBuffer && size->h > 0 && size->w > 0)
+    {
+      m_backBuffer->resize(size);
+    }
+#endif
+
   m_eventHandlers.raiseGeometryEvent();
   sched_unlock();
 }
@@ -421,6 +601,20 @@ void CWidgetControl::geometryEvent(NXHANDLE hWindow,
 
 void CWidgetControl::redrawEvent(FAR const struct nxgl_rect_s *nxRect, bool more)
 {
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+  // The exposed region can be restored from the back buffer on the next
+  // flush
+
+  if (m_backBuffer)
+    {
+      m_backBuffer->invalidate(nxRect);
+
+#ifdef CONFIG_NXWIDGET_EVENTWAIT
+      postWindowEvent();
+#endif
+    }
+#endif
+
   m_eventHandlers.raiseRedrawEvent(nxRect, more);
 }
 
@@ -435,11 +629,46 @@ void CWidgetControl::redrawEvent(FAR const struct nxgl_rect_s *nxRect, bool more
 
 #ifdef CONFIG_NX_XYINPUT
 void CWidgetControl::newMouseEvent(FAR const struct nxgl_point_s *pos, uint8_t buttons)
+{
+#ifdef CONFIG_NXWIDGETS_XYQUEUE
+  // Queue the sample until the next poll
+
+  queueMouseEvent(pos, buttons);
+#else
+  // Update the button state now.  Only the latest sample is kept.
+
+  updateMouseState(pos->x, pos->y, buttons);
+#endif
+
+  // Notify any external logic that a mouse event has occurred
+
+  m_eventHandlers.raiseMouseEvent(pos, buttons);
+
+#ifdef CONFIG_NXWIDGET_EVENTWAIT
+  // Then wake up logic that may be waiting for a window event
+
+  postWindowEvent();
+#endif
+}
+#endif
+
+/**
+ * Update the mouse/touchscreen state with a new sample, detecting button
+ * press, drag and release events.
+ *
+ * @param x The X coordinate of the sample.
+ * @param y The Y coordinate of the sample.
+ * @param buttons See NX_MOUSE_* definitions.
+ */
+
+#ifdef CONFIG_NX_XYINPUT
+void CWidgetControl::updateMouseState(nxgl_coord_t x, nxgl_coord_t y,
+                                      uint8_t buttons)
 {
   // Save the mouse X/Y position
 
-  m_xyinput.x = pos->x;
-  m_xyinput.y = pos->y;
+  m_xyinput.x = x;
+  m_xyinput.y = y;
 
   // Update button press states
 
@@ -552,16 +781,144 @@ void CWidgetControl::newMouseEvent(FAR const struct nxgl_point_s *pos, uint8_t b
       m_xyinput.rightHeld = 0;
     }
 #endif
+}
+#endif
 
-  // Notify any external logic that a mouse event has occurred
+/**
+ * Add a sample to the mouse/touchscreen queue.  A sample with the same
+ * buttons as the sample before it replaces the position of the last
+ * queued sample if that sample is not an edge.
+ *
+ * @param pos The (x,y) position of the mouse.
+ * @param buttons See NX_MOUSE_* definitions.
+ */
 
-  m_eventHandlers.raiseMouseEvent(pos, buttons);
+#ifdef CONFIG_NXWIDGETS_XYQUEUE
+void CWidgetControl::queueMouseEvent(FAR const struct nxgl_point_s *pos,
+                                     uint8_t buttons)
+{
+  bool edge = (buttons != m_xybuttons);
+  m_xybuttons = buttons;
 
-#ifdef CONFIG_NXWIDGET_EVENTWAIT
-  // Then wake up logic that may be waiting for a window event
+  // The queue is shared with pollMouseEvents()
 
-  postWindowEvent();
+  sched_lock();
+
+  if (!edge && m_xycount > 0)
+    {
+      // Coalesce a move with the move queued before it
+
+      int index = (m_xyhead + m_xycount - 1) % CONFIG_NXWIDGETS_XYQUEUE_SIZE;
+      FAR struct SXYSample *last = &m_xyqueue[index];
+
+      if (!last->edge)
+        {
+          last->x = pos->x;
+          last->y = pos->y;
+          m_xyMerged++;
+
+          sched_unlock();
+          return;
+        }
+    }
+
+  // If the queue is full, make room by discarding the oldest move.  Button
+  // press and release edges are kept.
+
+  if (m_xycount >= CONFIG_NXWIDGETS_XYQUEUE_SIZE)
+    {
+      int i;
+      for (i = 0; i < m_xycount; i++)
+        {
+          int index = (m_xyhead + i) % CONFIG_NXWIDGETS_XYQUEUE_SIZE;
+          if (!m_xyqueue[index].edge)
+            {
+              break;
+            }
+        }
+
+      if (i < m_xycount)
+        {
+          // Close the gap left by the discarded move
+
+          for (; i < m_xycount - 1; i++)
+            {
+              int index = (m_xyhead + i) % CONFIG_NXWIDGETS_XYQUEUE_SIZE;
+              m_xyqueue[index] =
+                m_xyqueue[(index + 1) % CONFIG_NXWIDGETS_XYQUEUE_SIZE];
+            }
+        }
+      else if (!edge)
+        {
+          // Every queued sample is an edge.  Discard the new move instead.
+
+          m_xyDropped++;
+          sched_unlock();
+          return;
+        }
+      else
+        {
+          // Every queued sample is an edge and so is the new sample.  The
+          // widgets have not been polled for a whole queue of button
+          // changes.  Only now is the oldest edge discarded.
+
+          m_xyhead = (m_xyhead + 1) % CONFIG_NXWIDGETS_XYQUEUE_SIZE;
+        }
+
+      m_xycount--;
+      m_xyDropped++;
+    }
+
+  int index = (m_xyhead + m_xycount) % CONFIG_NXWIDGETS_XYQUEUE_SIZE;
+  FAR struct SXYSample *sample = &m_xyqueue[index];
+
+  sample->x       = pos->x;
+  sample->y       = pos->y;
+  sample->buttons = buttons;
+  sample->edge    = edge;
+  m_xycount++;
+
+  sched_unlock();
+}
 #endif
+
+/**
+ * Work queue callback that runs when the minimum drag period of a held
+ * move has passed.  It only wakes the thread waiting in
+ * waitForWindowEvent(); the held move is then dispatched by the next call
+ * to pollEvents() on that thread.
+ *
+ * @param arg The CWidgetControl instance.
+ */
+
+#ifdef NXWIDGETS_XYQUEUE_REPOLL
+void CWidgetControl::xyWorkCallback(FAR void *arg)
+{
+  FAR CWidgetControl *This = (FAR CWidgetControl *)arg;
+
+  // The instance is not touched after the scheduler is unlocked, so the
+  // destructor may free it as soon as it is woken.
+
+  sched_lock();
+
+  // Post even if no one is waiting yet.  The poller may be about to wait
+  // after a poll that ran just before the period passed; the post then
+  // makes that wait return at once.  At most one such post is left
+  // pending.
+
+  int value;
+  if (sem_getvalue(&This->m_waitSem, &value) == OK && value <= 0)
+    {
+      sem_post(&This->m_waitSem);
+    }
+
+  This->m_xyWorkPending--;
+  if (This->m_xyWorkPending == 0 && This->m_xyWorkWaiting)
+    {
+      sem_post(&This->m_xyWorkSem);
+    }
+
+  sched_unlock();
 }
 #endif
 
@@ -640,14 +997,108 @@ void CWidgetControl::newCursorControlEvent(ECursorControl cursorControl)
 
 bool CWidgetControl::createGraphicsPort(INxWindow *window)
 {
+  INxWindow *target = window;
+
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+  // Remember the window so that the port can be redirected if double
+  // buffering is enabled or disabled later
+
+  m_window = window;
+
+  // Send anything not yet flushed from the old back buffer to the window.
+  // The old back buffer is kept until the port no longer draws into it.
+
+  CBufferedWindow *oldBuffer = m_backBuffer;
+  m_backBuffer = NULL;
+
+  if (oldBuffer)
+    {
+      oldBuffer->flush();
+    }
+
+  // Draw into a back buffer if double buffering is selected for this
+  // window.  Draw directly in the window if the back buffer cannot be
+  // created.
+
+  if (m_doubleBuffered)
+    {
+      m_backBuffer = new CBufferedWindow(window);
+      if (m_backBuffer)
+        {
+          if (m_haveGeometry)
+            {
+              m_backBuffer->resize(&m_size);
+            }
+
+          target = m_backBuffer;
+        }
+    }
+#endif
+
+  // Keep the existing port, if there is one, so that pointers returned by
+  // getGraphicsPort() remain valid.  Only the window it draws to changes.
+
+  if (m_port)
+    {
+      m_port->setWindow(target);
+    }
+  else
+    {
 #ifdef CONFIG_NX_WRITEONLY
-  m_port = new CGraphicsPort(window, m_style.colors.background);
+      m_port = new CGraphicsPort(target, m_style.colors.background);
 #else
-  m_port = new CGraphicsPort(window);
+      m_port = new CGraphicsPort(target);
 #endif
+    }
+
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+  if (oldBuffer)
+    {
+      delete oldBuffer;
+    }
+#endif
+
   return m_port != NULL;
 }
 
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+/**
+ * Select whether this window draws into an off-screen back buffer.
+ *
+ * @param enable True: draw into a back buffer; False: draw directly in
+ *   the window.
+ * @return True on success.
+ */
+
+bool CWidgetControl::setDoubleBuffered(bool enable)
+{
+  m_doubleBuffered = enable;
+
+  // If the window does not yet exist, the back buffer will be created
+  // along with the graphics port
+
+  if (m_window == NULL)
+    {
+      return true;
+    }
+
+  return createGraphicsPort(m_window);
+}
+
+/**
+ * Send everything drawn in the back buffer since the last flush to the
+ * window.
+ */
+
+void CWidgetControl::flushBackBuffer(void)
+{
+  if (m_backBuffer)
+    {
+      m_backBuffer->flush();
+    }
+}
+#endif
+
 /**
  * Copy a widget style
  *
@@ -780,6 +1231,108 @@ void CWidgetControl::processDeleteQueue(void)
 
 bool CWidgetControl::pollMouseEvents(CNxWidget *widget)
 {
+#ifdef CONFIG_NXWIDGETS_XYQUEUE
+  // Nothing has been queued since the last poll.  Process the current
+  // state just as when there is no queue.
+
+  if (m_xycount == 0)
+    {
+      return dispatchMouseEvents(widget);
+    }
+
+  // Process each queued sample in order
+
+  bool mouseEvent = false;
+
+  for (; ; )
+    {
+      sched_lock();
+
+      if (m_xycount == 0)
+        {
+          sched_unlock();
+          break;
+        }
+
+      struct SXYSample sample = m_xyqueue[m_xyhead];
+
+#if CONFIG_NXWIDGETS_XYQUEUE_MINPERIOD > 0
+      // Hold back a move that arrived too soon after the last drag.  It
+      // will be coalesced with later moves.  A move queued before a press
+      // or release is always sent so that the edge is not delayed.
+
+      if (!sample.edge && (sample.buttons & NX_MOUSE_LEFTBUTTON) != 0 &&
+          m_xycount == 1)
+        {
+          uint32_t elapsed = elapsedTime(&m_xyDragTime);
+          if (elapsed < CONFIG_NXWIDGETS_XYQUEUE_MINPERIOD)
+            {
+#ifdef NXWIDGETS_XYQUEUE_REPOLL
+              // Nothing else may arrive if the pointer has stopped.  Wake
+              // the poller again when the period has passed so that the
+              // move is not held forever.  A re-poll that is already
+              // queued is replaced.
+
+              bool idle = work_available(&m_xyWork);
+              uint32_t ticks = (CONFIG_NXWIDGETS_XYQUEUE_MINPERIOD - elapsed +
+                                MSEC_PER_TICK - 1) / MSEC_PER_TICK;
+              int ret = work_queue(USRWORK, &m_xyWork, xyWorkCallback, this,
+                                   ticks);
+              if (ret < 0)
+                {
+                  gerr("ERROR: work_queue failed: %d\n", ret);
+                }
+              else if (idle)
+                {
+                  m_xyWorkPending++;
+                }
+#endif
+
+              sched_unlock();
+              break;
+            }
+        }
+#endif
+
+      m_xyhead = (m_xyhead + 1) % CONFIG_NXWIDGETS_XYQUEUE_SIZE;
+      m_xycount--;
+
+      sched_unlock();
+
+      // Process the sample
+
+      updateMouseState(sample.x, sample.y, sample.buttons);
+
+#if CONFIG_NXWIDGETS_XYQUEUE_MINPERIOD > 0
+      if (m_xyinput.leftDrag)
+        {
+          clock_gettime(CLOCK_REALTIME, &m_xyDragTime);
+        }
+#endif
+
+      if (dispatchMouseEvents(widget))
+        {
+          mouseEvent = true;
+        }
+    }
+
+  return mouseEvent;
+#else
+  return dispatchMouseEvents(widget);
+#endif
+}
+
+/**
+ * Send the events detected by the last call to updateMouseState()
+ * throughout the hierarchy.
+ *
+ * @param widget. Specific widget to poll.  Use NULL to run the
+ *    all widgets in the window.
+ * @return True means an interesting mouse event occurred
+ */
+
+bool CWidgetControl::dispatchMouseEvents(CNxWidget *widget)
+{
 #ifdef CONFIG_NX_XYINPUT
   bool mouseEvent = false;  // Assume that no interesting mouse event occurred
 
@@ -69,6 +69,8 @@
 #include "graphics/nxwidgets/cnxstring.hxx"
 #include "graphics/nxwidgets/cwidgetstyle.hxx"
 #include "graphics/nxwidgets/cnxfont.hxx"
+#include "graphics/nxwidgets/cglyphcache.hxx"
+#include "graphics/nxwidgets/cspancache.hxx"
 #include "graphics/nxwidgets/singletons.hxx"
 
 /****************************************************************************
@@ -84,6 +86,12 @@ using namespace NXWidgets;
 CWidgetStyle        *NXWidgets::g_defaultWidgetStyle; /**< The default widget style */
 CNxString           *NXWidgets::g_nullString;         /**< The reusable empty string */
 TNxArray<CNxTimer*> *NXWidgets::g_nxTimers;           /**< An array of all timers */
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+CGlyphCache         *NXWidgets::g_glyphCache;         /**< The shared glyph cache */
+#endif
+#ifdef CONFIG_NXWIDGETS_SPANCACHE
+CSpanCache          *NXWidgets::g_spanCache;          /**< The shared span cache */
+#endif
 
 /****************************************************************************
  * Method Implementations
@@ -145,6 +153,28 @@ void NXWidgets::instantiateSingletons(void)
       g_nxTimers = new TNxArray<CNxTimer*>();
     }
 
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+  // Create the glyph cache
+
+  if (!g_glyphCache)
+    {
+      g_glyphCache = new CGlyphCache(CONFIG_NXWIDGETS_GLYPHCACHE_SIZE);
+    }
+#endif
+
+#ifdef CONFIG_NXWIDGETS_SPANCACHE
+  // Create the opaque span cache
+
+  if (!g_spanCache)
+    {
+#ifdef CONFIG_NXWIDGETS_SPANCACHE_MERGE
+      g_spanCache = new CSpanCache(CONFIG_NXWIDGETS_SPANCACHE_SIZE, true);
+#else
+      g_spanCache = new CSpanCache(CONFIG_NXWIDGETS_SPANCACHE_SIZE, false);
+#endif
+    }
+#endif
+
   sched_unlock();
 }
 
@@ -183,4 +213,24 @@ void NXWidgets::freeSingletons(void)
       g_nxTimers = NULL;
     }
 
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+  // Free the glyph cache
+
+  if (g_glyphCache)
+    {
+      delete g_glyphCache;
+      g_glyphCache = NULL;
+    }
+#endif
+
+#ifdef CONFIG_NXWIDGETS_SPANCACHE
+  // Free the span cache
+
+  if (g_spanCache)
+    {
+      delete g_spanCache;
+      g_spanCache = NULL;
+    }
+#endif
+
 }
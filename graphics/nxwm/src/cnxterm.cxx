@@ -26,6 +26,7 @@
 
 #include <cstdio>
 #include <cstdlib>
+#include <cerrno>
 #include <ctime>
 
 #include <sys/boardctl.h>
@@ -36,6 +37,12 @@
 #include <debug.h>
 #include <unistd.h>
 
+#ifdef CONFIG_NXWM_NXTERM_BATCH
+#  include <cstring>
+#  include <poll.h>
+#  include <nuttx/nx/nxfonts.h>
+#endif
+
 #include "nshlib/nshlib.h"
 
 #include "graphics/nxwidgets/cwidgetcontrol.hxx"
@@ -92,6 +99,39 @@ namespace NxWM
  * Private Functions
  ********************************************************************************************/
 
+#ifdef CONFIG_NXWM_NXTERM_BATCH
+/**
+ * Return the number of bytes at the beginning of a batch of output that do not need to be
+ * written because they would scroll out of the window anyway.  Only complete lines are
+ * skipped and the newline before the first line that is kept is still written, so the
+ * kept output starts at the beginning of a new row exactly as it would have.  At least
+ * nRows newlines must follow that newline.  nRows may be larger than the number of rows in
+ * the window, that only means that less output is skipped.
+ *
+ * @param buffer The batch of output
+ * @param nbytes The number of bytes in the batch
+ * @param nRows The maximum number of text rows in the window
+ * @return The number of bytes that may be skipped
+ */
+
+static size_t hiddenOutput(FAR const char *buffer, size_t nbytes, int nRows)
+{
+  // Work backward from the end of the batch until nRows newlines have been seen.  The
+  // newline before those is the one that the kept output starts with.
+
+  int nNewlines = 0;
+  for (size_t i = nbytes; i > 0; i--)
+    {
+      if (buffer[i - 1] == '\n' && nNewlines++ == nRows)
+        {
+          return i - 1;
+        }
+    }
+
+  return 0;
+}
+#endif
+
 /********************************************************************************************
  * CNxTerm Method Implementations
  ********************************************************************************************/
@@ -116,6 +156,11 @@ CNxTerm::CNxTerm(CTaskbar *taskbar, CApplicationWindow *window)
   m_pid    = -1;
   m_nxterm = 0;
 
+#ifdef CONFIG_NXWM_NXTERM_BATCH
+  m_relay       = -1;
+  m_relayBuffer = (FAR char *)0;
+#endif
+
   // Add our personalized window label
 
   NXWidgets::CNxString myName = getName();
@@ -316,6 +361,29 @@ void CNxTerm::stop(void)
       task_delete(pid);
     }
 
+#ifdef CONFIG_NXWM_NXTERM_BATCH
+  // Delete the output task too.  It holds the NxTerm driver open and it
+  // does not see end-of-file while a background task started by NSH still
+  // has the pipe open.  The output task clears m_relay itself if it exits
+  // first.
+
+  sched_lock();
+  if (m_relay >= 0)
+    {
+      pid_t pid = m_relay;
+      m_relay = -1;
+      task_delete(pid);
+    }
+
+  sched_unlock();
+
+  if (m_relayBuffer)
+    {
+      delete[] m_relayBuffer;
+      m_relayBuffer = (FAR char *)0;
+    }
+#endif
+
   // Destroy the NX console device
 
   if (m_nxterm)
@@ -480,6 +548,86 @@ int CNxTerm::nxterm(int argc, char *argv[])
       goto errout;
     }
 
+  // By default, output goes directly to the NxTerm driver
+
+  int outfd;
+  outfd = fd;
+
+#ifdef CONFIG_NXWM_NXTERM_BATCH
+  // Send the output through a pipe to the output task instead.  If that is not possible,
+  // then just continue without batching.
+
+  FAR CNxTerm *This;
+  This = (FAR CNxTerm *)g_nxtermvars.console;
+  This->m_relayBuffer = new char[CONFIG_NXWM_NXTERM_BATCH_SIZE];
+
+  int pipefd[2];
+  if (This->m_relayBuffer && pipe(pipefd) == 0)
+    {
+      // The output task needs to know the most text rows that can fit in the window.
+      // Assume no line separation and at least one pixel per row if the font is not
+      // available.
+
+      int nRows = g_nxtermvars.wndo.wsize.h + 1;
+
+      NXHANDLE hfont = nxf_getfonthandle(g_nxtermvars.wndo.fontid);
+      if (hfont)
+        {
+          FAR const struct nx_font_s *fontset = nxf_getfontset(hfont);
+          if (fontset && fontset->mxheight > 0)
+            {
+              nRows = g_nxtermvars.wndo.wsize.h / fontset->mxheight + 1;
+            }
+        }
+
+      // task_create() doesn't handle binary arguments
+
+      char arg[5][24];
+      snprintf(arg[0], 24, "%p", This);
+      snprintf(arg[1], 24, "%d", pipefd[0]);
+      snprintf(arg[2], 24, "%d", pipefd[1]);
+      snprintf(arg[3], 24, "%d", fd);
+      snprintf(arg[4], 24, "%d", nRows);
+
+      FAR char *relayArgv[6];
+      relayArgv[0] = arg[0];
+      relayArgv[1] = arg[1];
+      relayArgv[2] = arg[2];
+      relayArgv[3] = arg[3];
+      relayArgv[4] = arg[4];
+      relayArgv[5] = (FAR char *)0;
+
+      // The output task inherits copies of all of these file descriptors.
+      // Keep it from running until its task ID has been saved for stop().
+
+      sched_lock();
+      This->m_relay = task_create("NxTerm Output", CONFIG_NXWM_NXTERM_PRIO,
+                                  CONFIG_NXWM_NXTERM_BATCH_STACKSIZE,
+                                  outputRelay, relayArgv);
+      if (This->m_relay < 0)
+        {
+          gerr("ERROR: Failed to create the NxTerm output task\n");
+          This->m_relay = -1;
+          ::close(pipefd[1]);
+        }
+      else
+        {
+          outfd = pipefd[1];
+        }
+
+      sched_unlock();
+      ::close(pipefd[0]);
+    }
+
+  // The batch buffer is not needed if there is no output task
+
+  if (outfd == fd && This->m_relayBuffer)
+    {
+      delete[] This->m_relayBuffer;
+      This->m_relayBuffer = (FAR char *)0;
+    }
+#endif
+
   // Now re-direct stdout and stderr so that they use the NX console driver.
   // Notes: (1) stdin is retained (file descriptor 0, probably the the serial
   // console).  (2) Don't bother trying to put debug instrumentation in the
@@ -491,16 +639,21 @@ int CNxTerm::nxterm(int argc, char *argv[])
 #ifdef CONFIG_NXTERM_NXKBDIN
   dup2(fd, 0);
 #endif
-  dup2(fd, 1);
-  dup2(fd, 2);
+  dup2(outfd, 1);
+  dup2(outfd, 2);
 
-  // And we can close our original driver file descriptor
+  // And we can close our original driver file descriptors
 
   if (fd > 2)
     {
       ::close(fd);
     }
 
+  if (outfd != fd && outfd > 2)
+    {
+      ::close(outfd);
+    }
+
   // Inform the parent thread that we successfully initialized
 
   g_nxtermvars.result = true;
@@ -525,6 +678,143 @@ errout:
   return EXIT_FAILURE;
 }
 
+#ifdef CONFIG_NXWM_NXTERM_BATCH
+/**
+ * This is the NxTerm output task.  It receives the NSH output through a pipe, collects
+ * the output for up to one batch period and then writes it to the NxTerm driver in a
+ * single write.  Lines that would scroll out of the window within the same batch are not
+ * written at all.
+ *
+ * argv[1] is the CNxTerm instance, argv[2] is the read end of the pipe, argv[3] is the
+ * write end of the pipe, argv[4] is the NxTerm driver and argv[5] is the maximum number of
+ * text rows in the window.  The batch buffer is owned by the CNxTerm instance so that it is
+ * not lost when CNxTerm::stop() deletes this task.
+ */
+
+int CNxTerm::outputRelay(int argc, char *argv[])
+{
+  FAR CNxTerm *This = (FAR CNxTerm *)strtoul(argv[1], NULL, 16);
+  int infd  = atoi(argv[2]);
+  int outfd = atoi(argv[4]);
+  int nRows = atoi(argv[5]);
+
+  // Close our copy of the write end of the pipe.  Then the read will report end-of-file
+  // when the NxTerm task and all of the tasks that it started have exited.
+
+  ::close(atoi(argv[3]));
+
+  FAR char *buffer = This->m_relayBuffer;
+  bool lastEscape = false;
+  for (; ; )
+    {
+      // Wait for the first output of the next batch
+
+      ssize_t nbytes = read(infd, buffer, CONFIG_NXWM_NXTERM_BATCH_SIZE);
+      if (nbytes < 0 && errno == EINTR)
+        {
+          continue;
+        }
+      else if (nbytes <= 0)
+        {
+          break;
+        }
+
+      // Then keep collecting output until the batch period expires or the buffer is full
+
+      struct timespec start;
+      clock_gettime(CLOCK_MONOTONIC, &start);
+
+      bool eof = false;
+      while (nbytes < CONFIG_NXWM_NXTERM_BATCH_SIZE)
+        {
+          struct timespec now;
+          clock_gettime(CLOCK_MONOTONIC, &now);
+
+          int elapsed = (now.tv_sec - start.tv_sec) * 1000 +
+                        (now.tv_nsec - start.tv_nsec) / 1000000;
+          if (elapsed >= CONFIG_NXWM_NXTERM_BATCH_PERIOD)
+            {
+              break;
+            }
+
+          struct pollfd fds;
+          fds.fd      = infd;
+          fds.events  = POLLIN;
+          fds.revents = 0;
+
+          if (poll(&fds, 1, CONFIG_NXWM_NXTERM_BATCH_PERIOD - elapsed) <= 0)
+            {
+              break;
+            }
+
+          ssize_t nread = read(infd, &buffer[nbytes],
+                               CONFIG_NXWM_NXTERM_BATCH_SIZE - nbytes);
+          if (nread <= 0)
+            {
+              eof = (nread == 0);
+              break;
+            }
+
+          nbytes += nread;
+        }
+
+      // If the NxTerm task has exited, then the window is going away too.  Just discard
+      // the last output.
+
+      if (eof)
+        {
+          break;
+        }
+
+      // Skip the lines that would scroll out of view anyway.  This is not safe if the
+      // output contains escape sequences, since these may move the cursor.  That includes
+      // a sequence that started at the end of the previous batch.
+
+      bool escape = (memchr(buffer, '\x1b', nbytes) != NULL);
+      FAR const char *ptr = buffer;
+      if (!escape && !lastEscape)
+        {
+          ptr += hiddenOutput(buffer, nbytes, nRows);
+        }
+
+      lastEscape = escape;
+
+      // And write the rest of the batch at once
+
+      FAR const char *end = &buffer[nbytes];
+      while (ptr < end)
+        {
+          ssize_t nwritten = write(outfd, ptr, end - ptr);
+          if (nwritten < 0)
+            {
+              if (errno == EINTR)
+                {
+                  continue;
+                }
+
+              break;
+            }
+
+          ptr += nwritten;
+        }
+    }
+
+  // Let CNxTerm::stop() know that there is no task to delete any more.  The buffer can be
+  // freed here unless stop() has already taken it over.
+
+  sched_lock();
+  if (This->m_relay >= 0)
+    {
+      This->m_relay = -1;
+      delete[] This->m_relayBuffer;
+      This->m_relayBuffer = (FAR char *)0;
+    }
+
+  sched_unlock();
+  return EXIT_SUCCESS;
+}
+#endif
+
 /**
  * This is the NxTerm task exit handler.  It registered with on_exit()
  * and called automatically when the nxterm task exits.
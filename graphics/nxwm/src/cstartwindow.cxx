@@ -31,6 +31,9 @@
 #include <sched.h>
 
 #include "graphics/nxwidgets/cwidgetcontrol.hxx"
+#ifdef CONFIG_NXWM_ICONCACHE
+#  include "graphics/nxwidgets/ccachedbitmap.hxx"
+#endif
 
 #include "graphics/nxwm/nxwmconfig.hxx"
 #include "graphics/nxglyphs.hxx"
@@ -342,6 +345,20 @@ bool CStartWindow::addApplication(IApplicationFactory *app)
 
   NXWidgets::IBitmap *bitmap = app->getIcon();
 
+#ifdef CONFIG_NXWM_ICONCACHE
+  // Convert the icon to the display format now so that it does not have to
+  // be decoded again each time that the start window is drawn
+
+  NXWidgets::CCachedBitmap *cached = new NXWidgets::CCachedBitmap(bitmap);
+  if (!cached)
+    {
+      delete bitmap;
+      return false;
+    }
+
+  bitmap = cached;
+#endif
+
   // Create a CImage instance to manage the application icon
 
   NXWidgets::CImage *image =
@@ -349,6 +366,7 @@ bool CStartWindow::addApplication(IApplicationFactory *app)
                           bitmap->getHeight(), bitmap, 0);
   if (!image)
     {
+      delete bitmap;
       return false;
     }
 
@@ -451,9 +469,10 @@ void CStartWindow::removeAllApplications(void)
 
       IApplicationFactory *app = m_slots.at(0).app;
 
-      // Now, delete the image and the application
+      // Now, delete the icon bitmap, the image and the application
 
       delete app;
+      delete m_slots.at(0).image->getBitmap();
       delete m_slots.at(0).image;
 
       // And discard the data in this slot
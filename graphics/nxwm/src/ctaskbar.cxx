@@ -32,6 +32,9 @@
 #include "graphics/nxwidgets/cwidgetcontrol.hxx"
 #include "graphics/nxwidgets/cnxtkwindow.hxx"
 #include "graphics/nxwidgets/cscaledbitmap.hxx"
+#ifdef CONFIG_NXWM_ICONCACHE
+#  include "graphics/nxwidgets/ccachedbitmap.hxx"
+#endif
 
 #include "graphics/nxwm/cwindowmessenger.hxx"
 #include "graphics/nxwm/ctaskbar.hxx"
@@ -481,6 +484,20 @@ bool CTaskbar::startApplication(IApplication *app, bool minimized)
 #else
   if (bitmap)
     {
+#ifdef CONFIG_NXWM_ICONCACHE
+      // Convert the icon to the display format now so that it does not
+      // have to be decoded again each time that the task bar is drawn
+
+      NXWidgets::CCachedBitmap *cached = new NXWidgets::CCachedBitmap(bitmap);
+      if (!cached)
+        {
+          delete bitmap;
+          return false;
+        }
+
+      bitmap = cached;
+#endif
+
       w = bitmap->getWidth();
       h = bitmap->getHeight();
     }
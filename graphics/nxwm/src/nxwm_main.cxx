@@ -30,6 +30,10 @@
 #include <unistd.h>
 #include <sys/boardctl.h>
 
+#ifdef CONFIG_NXWM_STARTUP_TRACE
+#  include <time.h>
+#endif
+
 #ifdef CONFIG_NXWM_TOUCHSCREEN_CONFIGDATA
 #  include "platform/configdata.h"
 #endif
@@ -56,6 +60,17 @@
 #  include "graphics/nxwm/ckeyboard.hxx"
 #endif
 
+/////////////////////////////////////////////////////////////////////////////
+// Pre-processor Definitions
+/////////////////////////////////////////////////////////////////////////////
+
+#ifdef CONFIG_NXWM_STARTUP_TRACE
+#  define MAX_STARTUP_STEPS 16
+#  define traceStartup(s)   recordStartupStep(s)
+#else
+#  define traceStartup(s)
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 // Private Types
 /////////////////////////////////////////////////////////////////////////////
@@ -69,6 +84,12 @@ struct SNxWmTest
   struct NxWM::SCalibrationData calibData; // Calibration data
   bool                calibrated;          // True: Touchscreen has been calibrated
 #endif
+#ifdef CONFIG_NXWM_STARTUP_TRACE
+  struct timespec     start;               // Time that initialization started
+  struct timespec     stepTime[MAX_STARTUP_STEPS]; // Time that each step completed
+  FAR const char     *stepName[MAX_STARTUP_STEPS]; // Name of each step
+  int                 nSteps;              // Number of steps recorded
+#endif
 };
 
 /////////////////////////////////////////////////////////////////////////////
@@ -89,6 +110,54 @@ extern "C" int main(int argc, char *argv[]);
 // Public Functions
 /////////////////////////////////////////////////////////////////////////////
 
+/////////////////////////////////////////////////////////////////////////////
+// Name: recordStartupStep
+/////////////////////////////////////////////////////////////////////////////
+
+#ifdef CONFIG_NXWM_STARTUP_TRACE
+static void recordStartupStep(FAR const char *stepName)
+{
+  if (g_nxwmtest.nSteps < MAX_STARTUP_STEPS)
+    {
+      int step = g_nxwmtest.nSteps++;
+      clock_gettime(CLOCK_MONOTONIC, &g_nxwmtest.stepTime[step]);
+      g_nxwmtest.stepName[step] = stepName;
+    }
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Name: elapsedMsec
+/////////////////////////////////////////////////////////////////////////////
+
+static unsigned long elapsedMsec(FAR const struct timespec *from,
+                                 FAR const struct timespec *to)
+{
+  long msec = (to->tv_sec - from->tv_sec) * 1000 +
+              (to->tv_nsec - from->tv_nsec) / 1000000;
+  return msec > 0 ? (unsigned long)msec : 0;
+}
+
+/////////////////////////////////////////////////////////////////////////////
+// Name: showStartupTrace
+/////////////////////////////////////////////////////////////////////////////
+
+static void showStartupTrace(void)
+{
+  printf("nxwm_main: Startup timing:\n");
+
+  FAR const struct timespec *previous = &g_nxwmtest.start;
+  for (int i = 0; i < g_nxwmtest.nSteps; i++)
+    {
+      printf("  %-24s %6lu msec\n", g_nxwmtest.stepName[i],
+             elapsedMsec(previous, &g_nxwmtest.stepTime[i]));
+      previous = &g_nxwmtest.stepTime[i];
+    }
+
+  printf("  %-24s %6lu msec\n", "Total",
+         elapsedMsec(&g_nxwmtest.start, previous));
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 // Name: cleanup
 /////////////////////////////////////////////////////////////////////////////
@@ -336,16 +405,6 @@ static bool createCalibration(void)
       return false;
     }
 
-  // Call StartWindowFactory::create to create the start window application
-
-  printf("createCalibration: Creating CCalibration\n");
-  NxWM::IApplication *calibration = factory->create();
-  if (!calibration)
-    {
-      printf("createCalibration: ERROR: Failed to create CCalibration\n");
-      return false;
-    }
-
 #ifdef CONFIG_NXWM_TOUCHSCREEN_CONFIGDATA
   // Check if we have previously stored calibration data
 
@@ -369,6 +428,19 @@ static bool createCalibration(void)
   else
 #endif
     {
+      // Call CCalibrationFactory::create to create the calibration
+      // application.  This is only done when the calibration must run now;
+      // otherwise, the application is not created until it is selected from
+      // the start window.
+
+      printf("createCalibration: Creating CCalibration\n");
+      NxWM::IApplication *calibration = factory->create();
+      if (!calibration)
+        {
+          printf("createCalibration: ERROR: Failed to create CCalibration\n");
+          return false;
+        }
+
       // Call CTaskBar::startApplication to start the Calibration application.
       // Nothing will be displayed because the window manager has not yet been
       // started.
@@ -483,6 +555,12 @@ static bool createMediaPlayer(void)
 
 int main(int argc, char *argv[])
 {
+#ifdef CONFIG_NXWM_STARTUP_TRACE
+  // Record the time that initialization started
+
+  clock_gettime(CLOCK_MONOTONIC, &g_nxwmtest.start);
+#endif
+
 #if defined(CONFIG_BOARDCTL) && !defined(CONFIG_BOARD_LATE_INITIALIZE)
   // Should we perform board-specific initialization?  There are two ways
   // that board initialization can occur:  1) automatically via
@@ -491,6 +569,7 @@ int main(int argc, char *argv[])
   // (CONFIG_BOARDCTL=y).
 
   boardctl(BOARDIOC_INIT, 0);
+  traceStartup("Board initialization");
 #endif
 
 #ifdef CONFIG_NXWM_NXTERM
@@ -502,6 +581,8 @@ int main(int argc, char *argv[])
       printf("nxwm_main: ERROR: Failed to initialize the NSH library\n");
       return EXIT_FAILURE;
     }
+
+  traceStartup("NSH library");
 #endif
 
   // Create the task bar.
@@ -512,6 +593,8 @@ int main(int argc, char *argv[])
       testCleanUpAndExit(EXIT_FAILURE);
     }
 
+  traceStartup("Task bar");
+
   // Create the start window.
 
   if (!createStartWindow())
@@ -520,6 +603,8 @@ int main(int argc, char *argv[])
       testCleanUpAndExit(EXIT_FAILURE);
     }
 
+  traceStartup("Start window");
+
 #ifdef CONFIG_NXWM_KEYBOARD
   // Create the keyboard device
 
@@ -528,6 +613,8 @@ int main(int argc, char *argv[])
       printf("nxwm_main: ERROR: Failed to create the keyboard\n");
       testCleanUpAndExit(EXIT_FAILURE);
     }
+
+  traceStartup("Keyboard");
 #endif
 
 #ifdef CONFIG_NXWM_TOUCHSCREEN
@@ -538,6 +625,8 @@ int main(int argc, char *argv[])
       printf("nxwm_main ERROR: Failed to create the touchscreen\n");
       testCleanUpAndExit(EXIT_FAILURE);
     }
+
+  traceStartup("Touchscreen");
 #endif
 
 #ifdef CONFIG_NXWM_TOUCHSCREEN
@@ -548,6 +637,8 @@ int main(int argc, char *argv[])
       printf("nxwm_main ERROR: Failed to create the calibration application\n");
       testCleanUpAndExit(EXIT_FAILURE);
     }
+
+  traceStartup("Calibration");
 #endif
 
 #ifdef CONFIG_NXWM_NXTERM
@@ -558,6 +649,8 @@ int main(int argc, char *argv[])
       printf("nxwm_main: ERROR: Failed to create the NxTerm application\n");
       testCleanUpAndExit(EXIT_FAILURE);
     }
+
+  traceStartup("NxTerm");
 #endif
 
   // Create the hex calculator application and add it to the start window
@@ -568,6 +661,8 @@ int main(int argc, char *argv[])
       testCleanUpAndExit(EXIT_FAILURE);
     }
 
+  traceStartup("Hex calculator");
+
 #ifdef CONFIG_NXWM_MEDIAPLAYER
   // Create the media player application and add it to the start window
 
@@ -576,6 +671,8 @@ int main(int argc, char *argv[])
       printf("nxwm_main: ERROR: Failed to create the media player application\n");
       testCleanUpAndExit(EXIT_FAILURE);
     }
+
+  traceStartup("Media player");
 #endif
 
   // Call CTaskBar::startWindowManager to start the display with applications in place.
@@ -586,6 +683,14 @@ int main(int argc, char *argv[])
       testCleanUpAndExit(EXIT_FAILURE);
     }
 
+  traceStartup("Window manager");
+
+#ifdef CONFIG_NXWM_STARTUP_TRACE
+  // The desktop is now usable.  Show how long each step took.
+
+  showStartupTrace();
+#endif
+
 #ifdef CONFIG_NXWM_TOUCHSCREEN
 #ifdef CONFIG_NXWM_TOUCHSCREEN_CONFIGDATA
   // There are two possibilities:  (1) We started the calibration earlier and now
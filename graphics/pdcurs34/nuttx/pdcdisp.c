@@ -25,6 +25,7 @@
 #include <sys/ioctl.h>
 #include <assert.h>
 #include <errno.h>
+#include <string.h>
 #include <unistd.h>
 
 #ifdef CONFIG_SYSTEM_TERMCURSES
@@ -209,13 +210,15 @@ static inline pdc_color_t PDC_color(FAR struct pdc_fbstate_s *fbstate,
  * Description:
  *   Set memory to the device background RGB color.  For the case of BPP < 8,
  *   this is byte-aligned font buffer.  For other cases, this clears a patch
- *   of memory in the framebuffer.
+ *   of memory in the framebuffer or in the glyph cache.  stride is the
+ *   width of that memory in bytes.
  *
  ****************************************************************************/
 
 #if PDCURSES_BPP < 8
 static inline void PDC_set_bg(FAR struct pdc_fbstate_s *fbstate,
-                              FAR uint8_t *fbuffer, short bg)
+                              FAR uint8_t *fbuffer, unsigned int stride,
+                              short bg)
 {
   uint8_t color8;
   int row;
@@ -227,7 +230,7 @@ static inline void PDC_set_bg(FAR struct pdc_fbstate_s *fbstate,
 
   /* Now copy the color into the entire glyph region */
 
-  for (row = 0; row < fbstate->fheight; row++, fbuffer += fbstate->fstride)
+  for (row = 0; row < fbstate->fheight; row++, fbuffer += stride)
     {
       FAR uint8_t *fbdest = fbuffer;
 
@@ -244,7 +247,8 @@ static inline void PDC_set_bg(FAR struct pdc_fbstate_s *fbstate,
 }
 #else
 static inline void PDC_set_bg(FAR struct pdc_fbstate_s *fbstate,
-                              FAR uint8_t *fbstart, short bg)
+                              FAR uint8_t *fbstart, unsigned int stride,
+                              short bg)
 {
   pdc_color_t bgcolor = PDC_color(fbstate, bg);
   int row;
@@ -252,7 +256,7 @@ static inline void PDC_set_bg(FAR struct pdc_fbstate_s *fbstate,
 
   /* Set the glyph to the background color. */
 
-  for (row = 0; row < fbstate->fheight; row++, fbstart += fbstate->stride)
+  for (row = 0; row < fbstate->fheight; row++, fbstart += stride)
     {
       FAR pdc_color_t *fbdest;
 
@@ -271,28 +275,20 @@ static inline void PDC_set_bg(FAR struct pdc_fbstate_s *fbstate,
  *
  * Description:
  *   Render the font into the glyph memory using the foreground RGB color.
+ *   The glyph memory may be the framebuffer, the font buffer, or an entry
+ *   of the glyph cache.  The only difference is the stride value.
  *
  ****************************************************************************/
 
 static inline void PDC_render_glyph(FAR struct pdc_fbstate_s *fbstate,
                                     FAR const struct nx_fontbitmap_s *fbm,
-                                    FAR uint8_t *fbstart, short fg)
+                                    FAR uint8_t *fbstart,
+                                    unsigned int stride, short fg)
 {
   pdc_color_t fgcolor = PDC_color(fbstate, fg);
-  unsigned int stride;
   int ret;
 
-  /* Are we rendering into the framebuffer or the font buffer.  The only
-   * difference here is the stride value.
-   */
-
-#if PDCURSES_BPP < 8
-  stride = fbstate->fstride;  /* Width of the font buffer in bytes */
-#else
-  stride = fbstate->stride;   /* Width of the framebuffer in bytes */
-#endif
-
-  /* Then render the glyph into the allocated memory
+  /* Render the glyph into the allocated memory
    *
    * REVISIT:  The case where visibility==1 is not yet handled.  In that
    * case, only the lower quarter of the glyph should be reversed.
@@ -312,8 +308,8 @@ static inline void PDC_render_glyph(FAR struct pdc_fbstate_s *fbstate,
  * Name: PDC_copy_glyph
  *
  * Description:
- *   Copy the font from the the font buffer into the correct location in the
- *   the frame buffer.
+ *   Copy the font from the the font buffer (or from an entry of the glyph
+ *   cache) into the correct location in the the frame buffer.
  *
  *   For the case of pixel depth less then 1-byte, we will need to rend the
  *   font into a font buffer first, then copy it into the frame buffer at
@@ -323,6 +319,7 @@ static inline void PDC_render_glyph(FAR struct pdc_fbstate_s *fbstate,
 
 #if PDCURSES_BPP < 8
 static inline void  PDC_copy_glyph(FAR struct pdc_fbstate_s *fbstate,
+                                   FAR const uint8_t *src,
                                    FAR uint8_t *dest, unsigned int xpos)
 {
   FAR const uint8_t *srcrow;
@@ -390,7 +387,7 @@ static inline void  PDC_copy_glyph(FAR struct pdc_fbstate_s *fbstate,
 
   /* Then copy the image */
 
-  for (row = 0, srcrow  = fbstate->fbuffer, destrow = dest;
+  for (row = 0, srcrow  = src, destrow = dest;
        row < fbstate->fheight;
        row++, srcrow += fbstate->fstride, destrow += fbstate->stride)
     {
@@ -522,7 +519,137 @@ static void PDC_update(FAR struct pdc_fbstate_s *fbstate, int row, int col,
     }
 }
 #else
-#  define PDC_update(f,r,c,n)
+#  define PDC_update(f,r,c,n) UNUSED(n)
+#endif
+
+/****************************************************************************
+ * Name: PDC_render_cell
+ *
+ * Description:
+ *   Render one character with the selected colors into glyph memory.  That
+ *   memory may be the framebuffer, the font buffer, or an entry of the
+ *   glyph cache; stride is its width in bytes.
+ *
+ ****************************************************************************/
+
+static void PDC_render_cell(FAR struct pdc_fbstate_s *fbstate,
+                            FAR uint8_t *dest, unsigned int stride,
+                            chtype ch, short fg, short bg)
+{
+  FAR const struct nx_fontbitmap_s *fbm;
+#ifdef HAVE_BOLD_FONT
+  bool bold = ((ch & A_BOLD) != 0);
+#endif
+
+  /* Initialize the glyph to the (possibly reversed) background color */
+
+  PDC_set_bg(fbstate, dest, stride, bg);
+
+  /* Does the code map to a font? */
+
+#ifdef HAVE_BOLD_FONT
+  fbm = nxf_getbitmap(bold ? fbstate->hfont : fbstate->hbold,
+                      ch & A_CHARTEXT);
+#else
+  fbm = nxf_getbitmap(fbstate->hfont, ch & A_CHARTEXT);
+#endif
+
+  if (fbm != NULL)
+    {
+      /* Yes.. render the glyph */
+
+      PDC_render_glyph(fbstate, fbm, dest, stride, fg);
+    }
+
+  /* Apply more attributes */
+
+  if ((ch & (A_UNDERLINE | A_LEFTLINE | A_RIGHTLINE)) != 0)
+    {
+#warning Missing logic
+    }
+}
+
+/****************************************************************************
+ * Name: PDC_find_glyph
+ *
+ * Description:
+ *   Return the rendered image of a character from the glyph cache.  If the
+ *   character is not in the cache, it is rendered into the cache entry,
+ *   replacing the glyph that was held there.  NULL is returned if there is
+ *   no glyph cache.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+static FAR const uint8_t *PDC_find_glyph(FAR struct pdc_fbstate_s *fbstate,
+                                         chtype ch, short fg, short bg)
+{
+  FAR struct pdc_glyph_s *glyph;
+  FAR uint8_t *image;
+  unsigned int index;
+
+  if (fbstate->glyph == NULL)
+    {
+      return NULL;
+    }
+
+  /* Only the character code and the font selection affect the rendered
+   * image.  Color pair and A_REVERSE are already resolved into fg and bg.
+   */
+
+#ifdef HAVE_BOLD_FONT
+  ch &= (A_CHARTEXT | A_BOLD);
+#else
+  ch &= A_CHARTEXT;
+#endif
+
+  /* Select the one cache entry that may hold this glyph */
+
+  index = ((unsigned int)ch * 31 + (unsigned int)fg * 7 +
+           (unsigned int)bg) % CONFIG_PDCURSES_GLYPHCACHE_SIZE;
+  glyph = &fbstate->glyph[index];
+  image = fbstate->gbuffer + index * fbstate->gsize;
+
+  if (!glyph->valid || glyph->ch != ch || glyph->fg != fg ||
+      glyph->bg != bg)
+    {
+      /* Not cached.. render the glyph into the cache entry */
+
+      PDC_render_cell(fbstate, image, fbstate->gstride, ch, fg, bg);
+
+      glyph->ch    = ch;
+      glyph->fg    = fg;
+      glyph->bg    = bg;
+      glyph->valid = true;
+    }
+
+  return image;
+}
+#endif
+
+/****************************************************************************
+ * Name: PDC_blit_glyph
+ *
+ * Description:
+ *   Copy a rendered glyph from the glyph cache into the framebuffer.  For
+ *   the case of BPP < 8, PDC_copy_glyph() is used instead.
+ *
+ ****************************************************************************/
+
+#if defined(CONFIG_PDCURSES_GLYPHCACHE) && PDCURSES_BPP >= 8
+static inline void PDC_blit_glyph(FAR struct pdc_fbstate_s *fbstate,
+                                  FAR const uint8_t *image,
+                                  FAR uint8_t *dest)
+{
+  int row;
+
+  for (row = 0; row < fbstate->fheight; row++)
+    {
+      memcpy(dest, image, fbstate->gstride);
+      image += fbstate->gstride;
+      dest  += fbstate->stride;
+    }
+}
 #endif
 
 /****************************************************************************
@@ -537,13 +664,12 @@ static void PDC_update(FAR struct pdc_fbstate_s *fbstate, int row, int col,
 static void PDC_putc(FAR struct pdc_fbstate_s *fbstate, int row, int col,
                      chtype ch)
 {
-  FAR const struct nx_fontbitmap_s *fbm;
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+  FAR const uint8_t *image;
+#endif
   FAR uint8_t *dest;
   short fg;
   short bg;
-#ifdef HAVE_BOLD_FONT
-  bool bold = ((ch & A_BOLD) != 0);
-#endif
 #ifdef CONFIG_PDCURSES_MULTITHREAD
   FAR struct pdc_context_s *ctx = PDC_ctx();
 #endif
@@ -582,66 +708,76 @@ static void PDC_putc(FAR struct pdc_fbstate_s *fbstate, int row, int col,
     }
 #endif
 
+  /* Calculate the destination address in the framebuffer. */
+
+  dest = (FAR uint8_t *)fbstate->fbmem +
+                        PDC_fbmem_y(fbstate, row) +
+                        PDC_fbmem_x(fbstate, col);
+
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+  /* Copy the rendered glyph from the glyph cache, if there is one */
+
+  image = PDC_find_glyph(fbstate, ch, fg, bg);
+  if (image != NULL)
+    {
+#if PDCURSES_BPP < 8
+      PDC_copy_glyph(fbstate, image, dest, col);
+#else
+      PDC_blit_glyph(fbstate, image, dest);
+#endif
+      return;
+    }
+#endif
+
 #if PDCURSES_BPP < 8
   /* For the case of pixel depth less then 1-byte, we will need to rend the
    * font into a font buffer first, then copy it into the frame buffer at
    * the correct position when the font is completely rendered.
    */
 
-  dest = fbstate->fbuffer;
+  PDC_render_cell(fbstate, fbstate->fbuffer, fbstate->fstride, ch, fg, bg);
+  PDC_copy_glyph(fbstate, fbstate->fbuffer, dest, col);
 #else
-  /* Otherwise, we can rend directly into the frame buffer.  Calculate the
-   * destination address in the framebuffer.
-   */
+  /* Otherwise, we can rend directly into the frame buffer. */
 
-  dest = (FAR uint8_t *)fbstate->fbmem +
-                        PDC_fbmem_y(fbstate, row) +
-                        PDC_fbmem_x(fbstate, col);
+  PDC_render_cell(fbstate, dest, fbstate->stride, ch, fg, bg);
 #endif
+}
 
-  /* Initialize the glyph to the (possibly reversed) background color */
-
-  PDC_set_bg(fbstate, dest, bg);
-
-  /* Does the code map to a font? */
+/****************************************************************************
+ * Name: PDC_shadow_cell
+ *
+ * Description:
+ *   Record the character that is now drawn in one cell.  Returns true if
+ *   the cell already showed that character.
+ *
+ ****************************************************************************/
 
-#ifdef HAVE_BOLD_FONT
-  fbm = nxf_getbitmap(bold ? fbstate->hfont : fbstate->hbold,
-                      ch & A_CHARTEXT);
-#else
-  fbm = nxf_getbitmap(fbstate->hfont, ch & A_CHARTEXT);
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+static bool PDC_shadow_cell(FAR struct pdc_fbstate_s *fbstate, int row,
+                            int col, chtype ch)
+{
+#ifdef CONFIG_PDCURSES_MULTITHREAD
+  FAR struct pdc_context_s *ctx = PDC_ctx();
 #endif
+  FAR chtype *cell;
 
-  if (fbm != NULL)
+  if (fbstate->shadow == NULL ||
+      row < 0 || row >= SP->lines || col < 0 || col >= SP->cols)
     {
-      /* Yes.. render the glyph */
-
-      PDC_render_glyph(fbstate, fbm, dest, fg);
+      return false;
     }
 
-  /* Apply more attributes */
-
-  if ((ch & (A_UNDERLINE | A_LEFTLINE | A_RIGHTLINE)) != 0)
+  cell = &fbstate->shadow[row * SP->cols + col];
+  if (*cell == ch)
     {
-#warning Missing logic
+      return true;
     }
 
-#if PDCURSES_BPP < 8
-  /* Font is now completely rendered into the font buffer and can be copied
-   * to the framebuffer.
-   *
-   * Calculate the destination address in the framebuffer.
-   */
-
-  dest = (FAR uint8_t *)fbstate->fbmem +
-                        PDC_fbmem_y(fbstate, row) +
-                        PDC_fbmem_x(fbstate, col);
-
-  /* Then copy the glyph */
-
-  PDC_copy_glyph(fbstate, dest, col);
-#endif
+  *cell = ch;
+  return false;
 }
+#endif
 
 /****************************************************************************
  * Name: PDC_gotoyx
@@ -856,13 +992,13 @@ static void PDC_transform_line_term(FAR SCREEN *s, int lineno, int x,
 
       if (*srcp & A_ALTCHARSET)
         {
-          write(termstate->out_fd, "\x1b(0", 3);
-          write(termstate->out_fd, buffer, i);
-          write(termstate->out_fd, "\x1b(B", 3);
+          termcurses_write(termstate->tcurs, "\x1b(0", 3);
+          termcurses_write(termstate->tcurs, buffer, i);
+          termcurses_write(termstate->tcurs, "\x1b(B", 3);
         }
       else
         {
-          write(termstate->out_fd, buffer, i);
+          termcurses_write(termstate->tcurs, buffer, i);
         }
 
       srcp += i;
@@ -902,7 +1038,11 @@ void PDC_gotoyx(int row, int col)
 #ifdef CONFIG_SYSTEM_TERMCURSES
   if (!graphic_screen)
     {
+      FAR struct pdc_termscreen_s *termscreen =
+        (FAR struct pdc_termscreen_s *)SP;
+
       PDC_gotoyx_term(SP, row, col);
+      termcurses_flush(termscreen->termstate.tcurs);
       return;
     }
 #endif
@@ -917,6 +1057,9 @@ void PDC_gotoyx(int row, int col)
 
   PDC_putc(fbstate, oldrow, oldcol, curscr->_y[oldrow][oldcol]);
   PDC_update(fbstate, oldrow, oldcol, 1);
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  PDC_shadow_cell(fbstate, oldrow, oldcol, curscr->_y[oldrow][oldcol]);
+#endif
 
   if (SP->visibility != 0)
     {
@@ -927,6 +1070,9 @@ void PDC_gotoyx(int row, int col)
       ch = curscr->_y[row][col] ^ A_REVERSE;
       PDC_putc(fbstate, row, col, ch);
       PDC_update(fbstate, row, col, 1);
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+      PDC_shadow_cell(fbstate, row, col, ch);
+#endif
     }
 }
 
@@ -949,6 +1095,10 @@ void PDC_transform_line(int lineno, int x, int len, const chtype *srcp)
 #endif
   FAR struct pdc_fbscreen_s *fbscreen = (FAR struct pdc_fbscreen_s *)SP;
   FAR struct pdc_fbstate_s *fbstate;
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  int first = -1;
+  int last = -1;
+#endif
   int nextx;
   int i;
 
@@ -980,13 +1130,68 @@ void PDC_transform_line(int lineno, int x, int len, const chtype *srcp)
           break;
         }
 
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+      /* Skip the cell if it already shows this character.  This also
+       * applies when doupdate() redraws the whole screen after clear() or
+       * clearok():  The framebuffer is not cleared first, so a cell that
+       * is not drawn again keeps its content.
+       */
+
+      if (PDC_shadow_cell(fbstate, lineno, nextx, srcp[i]))
+        {
+          continue;
+        }
+
+      if (first < 0)
+        {
+          first = nextx;
+        }
+
+      last = nextx;
+#endif
+
       /* Render the font glyph into the framebuffer */
 
       PDC_putc(fbstate, lineno, nextx, srcp[i]);
     }
 
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  /* Update only the span of cells that actually changed */
+
+  if (first >= 0)
+    {
+      PDC_update(fbstate, lineno, first, last - first + 1);
+    }
+#else
   PDC_update(fbstate, lineno, x, nextx - x);
+#endif
+}
+
+/****************************************************************************
+ * Name: PDC_flush_output
+ *
+ * Description:
+ *   Send any output that the terminal emulation holds in its buffer.  This
+ *   is called at the end of each doupdate().  There is nothing to do for
+ *   the framebuffer.
+ *
+ ****************************************************************************/
+
+#ifdef CONFIG_SYSTEM_TERMCURSES
+void PDC_flush_output(void)
+{
+#ifdef CONFIG_PDCURSES_MULTITHREAD
+  FAR struct pdc_context_s *ctx = PDC_ctx();
+#endif
+  FAR struct pdc_termscreen_s *termscreen =
+    (FAR struct pdc_termscreen_s *)SP;
+
+  if (!graphic_screen && termscreen != NULL)
+    {
+      termcurses_flush(termscreen->termstate.tcurs);
+    }
 }
+#endif
 
 /****************************************************************************
  * Name: PDC_clear_screen
@@ -1070,3 +1275,43 @@ void PDC_clear_screen(FAR struct pdc_fbstate_s *fbstate)
     }
 #endif
 }
+
+/****************************************************************************
+ * Name: PDC_invalidate_cache
+ *
+ * Description:
+ *   Discard all rendered glyphs and forget the characters last drawn in
+ *   each cell.  This must be called whenever the colors change or the
+ *   framebuffer content is modified by other means.
+ *
+ ****************************************************************************/
+
+#ifdef PDCURSES_HAVE_CACHE
+void PDC_invalidate_cache(FAR struct pdc_fbstate_s *fbstate)
+{
+#ifdef CONFIG_PDCURSES_MULTITHREAD
+  FAR struct pdc_context_s *ctx = PDC_ctx();
+#endif
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+  int i;
+
+  if (fbstate->glyph != NULL)
+    {
+      for (i = 0; i < CONFIG_PDCURSES_GLYPHCACHE_SIZE; i++)
+        {
+          fbstate->glyph[i].valid = false;
+        }
+    }
+#endif
+
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  /* Memory filled with 0xff never matches a character that is drawn */
+
+  if (fbstate->shadow != NULL)
+    {
+      memset(fbstate->shadow, 0xff,
+             SP->lines * SP->cols * sizeof(chtype));
+    }
+#endif
+}
+#endif
@@ -28,6 +28,7 @@
 #include "nuttx/config.h"
 
 #include <stdint.h>
+#include <stdbool.h>
 
 #include "nuttx/input/djoystick.h"
 #include "nuttx/nx/nx.h"
@@ -174,6 +175,19 @@
 #  error "Unsupported bits-per-pixel"
 #endif
 
+/* Rendered glyph cache and cell shadow */
+
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+#  ifndef CONFIG_PDCURSES_GLYPHCACHE_SIZE
+#    define CONFIG_PDCURSES_GLYPHCACHE_SIZE 64
+#  endif
+#endif
+
+#undef PDCURSES_HAVE_CACHE
+#if defined(CONFIG_PDCURSES_GLYPHCACHE) || defined(CONFIG_PDCURSES_DIRTYSPAN)
+#  define PDCURSES_HAVE_CACHE 1
+#endif
+
 /* Convert bits to bytes to hold an even number of pixels */
 
 #define PDCURSES_ALIGN_UP(n)   (((n) + PDCURSES_BPP_MASK) >> 3)
@@ -218,6 +232,18 @@ typedef uint16_t pdc_color_t;
 typedef uint32_t pdc_color_t;
 #endif
 
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+/* Describes one entry of the rendered glyph cache */
+
+struct pdc_glyph_s
+{
+  chtype ch;               /* Character code and A_BOLD */
+  short fg;                /* Foreground color */
+  short bg;                /* Background color */
+  bool valid;              /* True: The entry holds a rendered glyph */
+};
+#endif
+
 /* This structure provides the overall state of the framebuffer device */
 
 struct pdc_fbstate_s
@@ -250,6 +276,21 @@ struct pdc_fbstate_s
   FAR uint8_t *fbuffer;    /* Allocated font buffer */
 #endif
 
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+  /* Rendered glyph cache */
+
+  unsigned int gstride;    /* Width of one rendered glyph (bytes) */
+  size_t gsize;            /* Size of one rendered glyph (bytes) */
+  FAR struct pdc_glyph_s *glyph; /* Cache entries */
+  FAR uint8_t *gbuffer;    /* Rendered glyphs, one per cache entry */
+#endif
+
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  /* Characters last drawn in each cell (SP->lines * SP->cols) */
+
+  FAR chtype *shadow;
+#endif
+
   /* Drawable area (See also SP->lines and SP->cols) */
 
   fb_coord_t xpos;         /* Drawing X position (pixels) */
@@ -349,6 +390,20 @@ EXTERN struct pdc_fbstate_s g_pdc_fbstate;
 
 void PDC_clear_screen(FAR struct pdc_fbstate_s *fbstate);
 
+/****************************************************************************
+ * Name: PDC_invalidate_cache
+ *
+ * Description:
+ *   Discard all rendered glyphs and forget the characters last drawn in
+ *   each cell.  This must be called whenever the colors change or the
+ *   framebuffer content is modified by other means.
+ *
+ ****************************************************************************/
+
+#ifdef PDCURSES_HAVE_CACHE
+void PDC_invalidate_cache(FAR struct pdc_fbstate_s *fbstate);
+#endif
+
 /****************************************************************************
  * Name: PDC_input_open
  *
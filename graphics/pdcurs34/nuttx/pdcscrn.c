@@ -387,6 +387,12 @@ void PDC_scr_free(void)
   close(fbstate->fbfd);
 #ifdef CONFIG_PDCURSES_HAVE_INPUT
   PDC_input_close(fbstate);
+#endif
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+  free(fbstate->glyph);
+#endif
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  free(fbstate->shadow);
 #endif
   free(fbscreen);
   SP = NULL;
@@ -652,6 +658,51 @@ int PDC_scr_open(int argc, char **argv)
 
   PDC_clear_screen(fbstate);
 
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+  /* Allocate the glyph cache.  The cache entries are followed by the
+   * rendered glyphs.  This is only an optimization:  Characters are
+   * rendered from the font each time if the allocation fails.
+   */
+
+#if PDCURSES_BPP < 8
+  fbstate->gstride = fbstate->fstride;
+#else
+  fbstate->gstride = fbstate->fwidth * sizeof(pdc_color_t);
+#endif
+  fbstate->gsize   = fbstate->gstride * fbstate->fheight;
+  fbstate->glyph   = (FAR struct pdc_glyph_s *)
+    zalloc(CONFIG_PDCURSES_GLYPHCACHE_SIZE *
+           (sizeof(struct pdc_glyph_s) + fbstate->gsize));
+
+  if (fbstate->glyph == NULL)
+    {
+      PDC_LOG(("WARNING: Failed to allocate glyph cache\n"));
+    }
+  else
+    {
+      fbstate->gbuffer = (FAR uint8_t *)
+        &fbstate->glyph[CONFIG_PDCURSES_GLYPHCACHE_SIZE];
+    }
+#endif
+
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  /* Allocate the copy of the characters drawn in each cell.  All cells
+   * are drawn each time if the allocation fails.
+   */
+
+  fbstate->shadow = (FAR chtype *)
+    malloc(SP->lines * SP->cols * sizeof(chtype));
+
+  if (fbstate->shadow == NULL)
+    {
+      PDC_LOG(("WARNING: Failed to allocate cell shadow\n"));
+    }
+#endif
+
+#ifdef PDCURSES_HAVE_CACHE
+  PDC_invalidate_cache(fbstate);
+#endif
+
 #ifdef CONFIG_PDCURSES_HAVE_INPUT
   /* Open and configure any input devices */
 
@@ -666,6 +717,12 @@ int PDC_scr_open(int argc, char **argv)
 
 #ifdef CONFIG_PDCURSES_HAVE_INPUT
 errout_with_fbuffer:
+#ifdef CONFIG_PDCURSES_GLYPHCACHE
+  free(fbstate->glyph);
+#endif
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  free(fbstate->shadow);
+#endif
 #if PDCURSES_BPP < 8
   free(fbstate->fbuffer);
 #endif
@@ -722,7 +779,29 @@ int PDC_resize_screen(int nlines, int ncols)
 
 void PDC_reset_prog_mode(void)
 {
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+#ifdef CONFIG_PDCURSES_MULTITHREAD
+  FAR struct pdc_context_s *ctx = PDC_ctx();
+#endif
+  FAR struct pdc_fbscreen_s *fbscreen = (FAR struct pdc_fbscreen_s *)SP;
+#endif
+
   PDC_LOG(("PDC_reset_prog_mode() - called.\n"));
+
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  /* The framebuffer may have been modified while in shell mode.  Draw all
+   * cells again on the next refresh.
+   */
+
+#ifdef CONFIG_SYSTEM_TERMCURSES
+  if (graphic_screen && fbscreen != NULL)
+#else
+  if (fbscreen != NULL)
+#endif
+    {
+      PDC_invalidate_cache(&fbscreen->fbstate);
+    }
+#endif
 }
 
 /****************************************************************************
@@ -806,6 +885,12 @@ void PDC_init_pair(short pair, short fg, short bg)
 
   fbstate->colorpair[pair].fg = fg;
   fbstate->colorpair[pair].bg = bg;
+
+#ifdef CONFIG_PDCURSES_DIRTYSPAN
+  /* Cells using this pair must be drawn again on the next refresh */
+
+  PDC_invalidate_cache(fbstate);
+#endif
 }
 
 /****************************************************************************
@@ -952,5 +1037,11 @@ int PDC_init_color(short color, short red, short green, short blue)
   fbstate->rgbcolor[color].blue  = DIVROUND(blue * 255, 1000);
 #endif
 
+#ifdef PDCURSES_HAVE_CACHE
+  /* Glyphs rendered with the old color are no longer valid */
+
+  PDC_invalidate_cache(fbstate);
+#endif
+
   return OK;
 }
@@ -273,6 +273,12 @@ int doupdate(void)
   SP->cursrow = curscr->_cury;
   SP->curscol = curscr->_curx;
 
+#ifdef CONFIG_SYSTEM_TERMCURSES
+  /* Send any buffered terminal output */
+
+  PDC_flush_output();
+#endif
+
   return OK;
 }
 
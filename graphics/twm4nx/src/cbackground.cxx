@@ -238,10 +238,17 @@ bool CBackground::redrawBackgroundWindow(FAR const struct nxgl_rect_s *rect,
 
       if (!nxgl_nullrect(&intersection))
         {
-          // Then re-draw the background image on the window
+          // Then re-draw that part of the background image on the window.
+          // Only the region being redrawn is touched so that, for example,
+          // the thin strips uncovered by a moving window do not cause the
+          // whole image to be redrawn.
 
           m_backImage->enableDrawing();
+
+          NXWidgets::CRect clipRect(&intersection);
+          port->setClipRect(clipRect);
           m_backImage->redraw();
+          port->clearClipRect();
         }
     }
 #endif
@@ -70,13 +70,115 @@
 #include "graphics/twm4nx/twm4nx_events.hxx"
 
 /////////////////////////////////////////////////////////////////////////////
-// Public Data
+// Private Types
 /////////////////////////////////////////////////////////////////////////////
 
 using namespace Twm4Nx;
 
+#ifdef CONFIG_TWM4NX_EVENTBATCH
+// One received event message
+
+union UEventMsg
+{
+  struct SEventMsg       eventmsg;
+  struct SRedrawEventMsg redrawmsg;
+  char                   buffer[MAX_EVENT_MSGSIZE];
+};
+#endif
+
+/////////////////////////////////////////////////////////////////////////////
+// Public Data
+/////////////////////////////////////////////////////////////////////////////
+
 const char Twm4Nx::GNoName[] = "Untitled";  // Name if no name is specified
 
+/////////////////////////////////////////////////////////////////////////////
+// Private Functions
+/////////////////////////////////////////////////////////////////////////////
+
+#ifdef CONFIG_TWM4NX_EVENTBATCH
+/**
+ * Check if an event only matters until a newer event of the same kind for
+ * the same object arrives.  Drag and resize movements carry the latest
+ * pointer position; a later one supersedes an earlier one.  Background
+ * redraws can be merged into one redraw of the combined region.
+ *
+ * @param eventID The event ID.
+ * @return True if the event may be merged with a later one.
+ */
+
+static bool isCoalescible(uint16_t eventID)
+{
+  switch (eventID)
+    {
+      case EVENT_WINDOW_DRAG:
+      case EVENT_ICONWIDGET_DRAG:
+      case EVENT_RESIZE_MOVE:
+      case EVENT_BACKGROUND_REDRAW:
+        return true;
+
+      default:
+        return false;
+    }
+}
+
+/**
+ * Merge the newest event in a batch with an earlier event of the same kind
+ * for the same object.  Only events after the last event that cannot be
+ * merged are considered so that the newest event never moves past any
+ * other kind of event.
+ *
+ * @param batch The batch of received events.
+ * @param nevents The number of events in the batch, including the newest.
+ * @return The number of events left in the batch.
+ */
+
+static int coalesceEvent(FAR union UEventMsg *batch, int nevents)
+{
+  FAR union UEventMsg *newest = &batch[nevents - 1];
+  uint16_t eventID = newest->eventmsg.eventID;
+
+  if (!isCoalescible(eventID))
+    {
+      return nevents;
+    }
+
+  for (int i = nevents - 2; i >= 0; i--)
+    {
+      FAR union UEventMsg *older = &batch[i];
+
+      if (!isCoalescible(older->eventmsg.eventID))
+        {
+          break;
+        }
+
+      if (older->eventmsg.eventID == eventID &&
+          older->eventmsg.obj == newest->eventmsg.obj)
+        {
+          // A redraw of the newer region must also cover the older one
+
+          if (eventID == EVENT_BACKGROUND_REDRAW)
+            {
+              nxgl_rectunion(&newest->redrawmsg.rect,
+                             &newest->redrawmsg.rect,
+                             &older->redrawmsg.rect);
+            }
+
+          // Remove the older event.  The order of the others is unchanged.
+
+          for (int j = i; j < nevents - 1; j++)
+            {
+              batch[j] = batch[j + 1];
+            }
+
+          return nevents - 1;
+        }
+    }
+
+  return nevents;
+}
+#endif
+
 /////////////////////////////////////////////////////////////////////////////
 // CTwm4Nx Implementation
 /////////////////////////////////////////////////////////////////////////////
@@ -310,6 +412,67 @@ bool CTwm4Nx::eventLoop(void)
   twminfo("Entering event loop\n");
   for (; ; )
     {
+#ifdef CONFIG_TWM4NX_EVENTBATCH
+      // Wait for the next NxWidget event
+
+      union UEventMsg batch[CONFIG_TWM4NX_EVENTBATCH_SIZE];
+
+      int ret = mq_receive(m_eventq, batch[0].buffer, MAX_EVENT_MSGSIZE,
+                           (FAR unsigned int *)0);
+      if (ret < 0)
+        {
+          twmerr("ERROR: mq_receive failed: %d\n", errno);
+          cleanup();
+          return false;
+        }
+
+      // Then collect the events that are already waiting.  This is the
+      // only reader of the queue so these receives will not block.
+      // Superseded movement and redraw events are dropped as they arrive.
+
+      int nevents = 1;
+
+      struct mq_attr attr;
+      if (mq_getattr(m_eventq, &attr) == OK)
+        {
+          for (long npending = attr.mq_curmsgs;
+               npending > 0 && nevents < CONFIG_TWM4NX_EVENTBATCH_SIZE;
+               npending--)
+            {
+              ret = mq_receive(m_eventq, batch[nevents].buffer,
+                               MAX_EVENT_MSGSIZE, (FAR unsigned int *)0);
+              if (ret < 0)
+                {
+                  twmerr("ERROR: mq_receive failed: %d\n", errno);
+                  cleanup();
+                  return false;
+                }
+
+              nevents = coalesceEvent(batch, nevents + 1);
+            }
+        }
+
+      // Dispatch the batch in the order received
+
+      for (int i = 0; i < nevents; i++)
+        {
+          FAR struct SEventMsg *eventmsg = &batch[i].eventmsg;
+
+          // If we are resizing, then drop all non-critical events (of
+          // course, all resizing events must be critical)
+
+          if (!m_resize->resizing() || EVENT_ISCRITICAL(eventmsg->eventID))
+            {
+              if (!dispatchEvent(eventmsg))
+                {
+                  twmerr("ERROR: dispatchEvent() failed, eventID=%u\n",
+                         eventmsg->eventID);
+                  cleanup();
+                  return false;
+                }
+            }
+        }
+#else
       // Wait for the next NxWidget event
 
       union
@@ -342,6 +505,7 @@ bool CTwm4Nx::eventLoop(void)
               return false;
             }
         }
+#endif
     }
 
   return true;  // Not reachable
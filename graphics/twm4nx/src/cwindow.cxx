@@ -44,6 +44,7 @@
 #include <fcntl.h>
 #include <mqueue.h>
 
+#include <nuttx/clock.h>
 #include <nuttx/nx/nxglib.h>
 #include <nuttx/nx/nxbe.h>
 
@@ -167,6 +168,9 @@ CWindow::CWindow(CTwm4Nx *twm4nx)
 
   m_clicked               = false;
   m_dragging              = false;
+#ifdef CONFIG_TWM4NX_OPAQUEMOVE
+  m_dragTime              = 0;
+#endif
   m_dragPos.x             = 0;
   m_dragPos.y             = 0;
   m_dragCSize.w           = 0;
@@ -1718,6 +1722,20 @@ bool CWindow::windowDrag(FAR struct SEventMsg *eventmsg)
 
   if (m_dragging)
     {
+#ifdef CONFIG_TWM4NX_OPAQUEMOVE
+      // Move the window no more often than the display can show it.  A
+      // skipped movement is not lost:  The drag position is not updated
+      // so the next movement, or the final one when the window is
+      // released, includes it.
+
+      clock_t now = clock_systime_ticks();
+      if (eventmsg->eventID == EVENT_WINDOW_DRAG &&
+          now - m_dragTime < MSEC2TICK(CONFIG_TWM4NX_OPAQUEMOVE_PERIOD))
+        {
+          return true;
+        }
+
+#endif
       // The coordinates in the eventmsg are relative to the origin
       // of the toolbar.
 
@@ -1781,6 +1799,9 @@ bool CWindow::windowDrag(FAR struct SEventMsg *eventmsg)
             }
 
           m_nxWin->synchronize();
+#ifdef CONFIG_TWM4NX_OPAQUEMOVE
+          m_dragTime = now;
+#endif
         }
 
       return true;
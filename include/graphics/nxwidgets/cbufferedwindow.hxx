@@ -0,0 +1,301 @@
+/****************************************************************************
+ * apps/include/graphics/nxwidgets/cbufferedwindow.hxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CBUFFEREDWINDOW_HXX
+#define __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CBUFFEREDWINDOW_HXX
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/inxwindow.hxx"
+#include "graphics/nxwidgets/cbitmap.hxx"
+#include "graphics/nxwidgets/crectlist.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+#if CONFIG_NXWIDGETS_BPP < 8
+#  error "Double-buffered windows require at least 8 bits per pixel"
+#endif
+
+/****************************************************************************
+ * Implementation Classes
+ ****************************************************************************/
+
+#if defined(__cplusplus)
+
+namespace NXWidgets
+{
+  /**
+   * CBufferedWindow is an off-screen back buffer for an NX window.  It
+   * implements INxWindow so that a CGraphicsPort can draw into it exactly
+   * as it would draw into the window.  All drawing goes to a memory bitmap
+   * the size of the window and the modified regions are recorded.  flush()
+   * then sends each modified region to the real window with a single
+   * bitmap operation.  Operations that do not draw are passed through to
+   * the real window.
+   *
+   * Until the size of the window is known (or if the back buffer cannot be
+   * allocated), drawing goes directly to the real window.
+   */
+
+  class CBufferedWindow : public INxWindow
+  {
+  private:
+    INxWindow          *m_window;  /**< The real window */
+    FAR uint8_t        *m_buffer;  /**< The back buffer memory */
+    struct SBitmap      m_bitmap;  /**< Describes the back buffer */
+    struct nxgl_size_s  m_size;    /**< The current size of the window */
+    bool                m_resized; /**< True: The back buffer must be re-allocated */
+    CRectList           m_dirty;   /**< Regions not yet sent to the window */
+
+    /**
+     * Make sure that the back buffer matches the size of the window,
+     * (re-)allocating it if necessary.  A new back buffer is initialized
+     * with the current contents of the window.
+     *
+     * @return True if the back buffer is available.
+     */
+
+    bool prepareBuffer(void);
+
+    /**
+     * Limit a rectangle to the back buffer.
+     *
+     * @param rect The rectangle to clip.
+     * @return False if nothing remains of the rectangle.
+     */
+
+    bool clipToBuffer(FAR struct nxgl_rect_s *rect) const;
+
+    /**
+     * Return the address of a pixel in the back buffer.  The rows are
+     * packed, so 24-bit pixels occupy three bytes.
+     */
+
+    inline FAR uint8_t *pixelAddress(nxgl_coord_t x, nxgl_coord_t y) const
+    {
+      return m_buffer + y * m_bitmap.stride +
+             (((uint32_t)x * CONFIG_NXWIDGETS_BPP) >> 3);
+    }
+
+    /**
+     * Record that a region of the back buffer has been modified.
+     *
+     * @param rect The modified region (already clipped to the buffer).
+     */
+
+    void markDirty(FAR const struct nxgl_rect_s *rect);
+
+    /**
+     * Fill a horizontal run of pixels in the back buffer.
+     */
+
+    void fillRun(nxgl_coord_t x1, nxgl_coord_t x2, nxgl_coord_t y,
+                 nxwidget_pixel_t color);
+
+    /**
+     * Copy constructor is protected to prevent usage.
+     */
+
+    inline CBufferedWindow(const CBufferedWindow &window)
+    : m_dirty(1) { }
+
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param window The real window that receives the back buffer contents.
+     */
+
+    CBufferedWindow(INxWindow *window);
+
+    /**
+     * Destructor.  The real window is not deleted.
+     */
+
+    ~CBufferedWindow(void);
+
+    /**
+     * Report a new window size.  The back buffer is re-allocated before the
+     * next drawing operation.
+     *
+     * @param size The new size of the window.
+     */
+
+    void resize(FAR const struct nxgl_size_s *size);
+
+    /**
+     * Mark a region of the window as needing to be sent again from the
+     * back buffer (for example, when it has been exposed).
+     *
+     * @param rect The window-relative region.
+     */
+
+    void invalidate(FAR const struct nxgl_rect_s *rect);
+
+    /**
+     * Send all modified regions of the back buffer to the real window, one
+     * bitmap operation per region.
+     *
+     * @return The number of regions that were sent.
+     */
+
+    int flush(void);
+
+    /**
+     * Get the back buffer.
+     *
+     * @return The back buffer bitmap or NULL if it is not yet allocated.
+     */
+
+    inline FAR const struct SBitmap *getBackBuffer(void) const
+    {
+      return m_buffer ? &m_bitmap : (FAR const struct SBitmap *)0;
+    }
+
+    /**
+     * INxWindow operations that are passed through to the real window.
+     */
+
+    inline bool open(void)
+    {
+      return m_window->open();
+    }
+
+    inline CWidgetControl *getWidgetControl(void) const
+    {
+      return m_window->getWidgetControl();
+    }
+
+    inline void synchronize(void)
+    {
+      m_window->synchronize();
+    }
+
+    inline bool requestPosition(void)
+    {
+      return m_window->requestPosition();
+    }
+
+    inline bool getPosition(FAR struct nxgl_point_s *pPos)
+    {
+      return m_window->getPosition(pPos);
+    }
+
+    inline bool getSize(FAR struct nxgl_size_s *pSize)
+    {
+      return m_window->getSize(pSize);
+    }
+
+    inline bool setPosition(FAR const struct nxgl_point_s *pPos)
+    {
+      return m_window->setPosition(pPos);
+    }
+
+    inline bool setSize(FAR const struct nxgl_size_s *pSize)
+    {
+      return m_window->setSize(pSize);
+    }
+
+    inline bool raise(void)
+    {
+      return m_window->raise();
+    }
+
+    inline bool lower(void)
+    {
+      return m_window->lower();
+    }
+
+    inline bool isVisible(void)
+    {
+      return m_window->isVisible();
+    }
+
+    inline bool show(void)
+    {
+      return m_window->show();
+    }
+
+    inline bool hide(void)
+    {
+      return m_window->hide();
+    }
+
+    inline bool modal(bool enable)
+    {
+      return m_window->modal(enable);
+    }
+
+#ifdef CONFIG_NXTERM_NXKBDIN
+    inline void redirectNxTerm(NXTERM handle)
+    {
+      m_window->redirectNxTerm(handle);
+    }
+#endif
+
+    /**
+     * INxWindow drawing operations that are performed in the back buffer.
+     */
+
+    bool setPixel(FAR const struct nxgl_point_s *pPos,
+                  nxgl_mxpixel_t color);
+
+    bool fill(FAR const struct nxgl_rect_s *pRect, nxgl_mxpixel_t color);
+
+    void getRectangle(FAR const struct nxgl_rect_s *rect,
+                      struct SBitmap *dest);
+
+    bool fillTrapezoid(FAR const struct nxgl_rect_s *pClip,
+                       FAR const struct nxgl_trapezoid_s *pTrap,
+                       nxgl_mxpixel_t color);
+
+    bool drawLine(FAR struct nxgl_vector_s *vector,
+                  nxgl_coord_t width, nxgl_mxpixel_t color,
+                  enum ELineCaps caps);
+
+    bool drawFilledCircle(struct nxgl_point_s *center, nxgl_coord_t radius,
+                          nxgl_mxpixel_t color);
+
+    bool move(FAR const struct nxgl_rect_s *pRect,
+              FAR const struct nxgl_point_s *pOffset);
+
+    bool bitmap(FAR const struct nxgl_rect_s *pDest,
+                FAR const void *pSrc,
+                FAR const struct nxgl_point_s *pOrigin,
+                unsigned int stride);
+  };
+}
+
+#endif // __cplusplus
+
+#endif // __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CBUFFEREDWINDOW_HXX
@@ -0,0 +1,170 @@
+/****************************************************************************
+ * apps/include/graphics/nxwidgets/ccachedbitmap.hxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CCACHEDBITMAP_HXX
+#define __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CCACHEDBITMAP_HXX
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/ibitmap.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Implementation Classes
+ ****************************************************************************/
+
+#if defined(__cplusplus)
+
+namespace NXWidgets
+{
+  /**
+   * Class that keeps a pre-converted copy of any bitmap that inherits from
+   * IBitmap.  The contained bitmap is read once, in the display format, and
+   * later runs are copied from memory.  This avoids decoding run-length
+   * encoded or scaled bitmaps, such as icons, each time that they are
+   * drawn.  The copy using the selected colors is made the first time that
+   * it is needed.
+   *
+   * The CCachedBitmap takes ownership of the contained bitmap and deletes it
+   * when the CCachedBitmap is deleted.
+   */
+
+  class CCachedBitmap : public IBitmap
+  {
+  protected:
+    FAR IBitmap *m_bitmap;   /**< The bitmap that is being cached */
+    FAR uint8_t *m_data[2];  /**< Normal and selected copies of the image */
+    size_t       m_stride;   /**< Width of one cached row in bytes */
+    bool         m_selected; /**< True: Use the selected copy */
+
+    /**
+     * Read the complete contained bitmap into one cached copy.
+     *
+     * @param selected True: Cache the image using the selected colors.
+     * @return True if the copy is available.
+     */
+
+    bool cacheImage(bool selected);
+
+    /**
+     * Copy constructor is protected to prevent usage.
+     */
+
+    inline CCachedBitmap(const CCachedBitmap &bitmap) { }
+
+  public:
+
+    /**
+     * Constructor.  The normal copy of the image is made immediately.
+     *
+     * @param bitmap The bitmap to be cached.
+     */
+
+    CCachedBitmap(FAR IBitmap *bitmap);
+
+    /**
+     * Destructor.
+     */
+
+    ~CCachedBitmap(void);
+
+    /**
+     * Get the bitmap's color format.
+     *
+     * @return The bitmap's color format.
+     */
+
+    const uint8_t getColorFormat(void) const;
+
+    /**
+     * Get the bitmap's color format.
+     *
+     * @return The bitmap's color format.
+     */
+
+    const uint8_t getBitsPerPixel(void) const;
+
+    /**
+     * Get the bitmap's width (in pixels/columns).
+     *
+     * @return The bitmap's width.
+     */
+
+    const nxgl_coord_t getWidth(void) const;
+
+    /**
+     * Get the bitmap's height (in rows).
+     *
+     * @return The bitmap's height.
+     */
+
+    const nxgl_coord_t getHeight(void) const;
+
+    /**
+     * Get the bitmap's width (in bytes).
+     *
+     * @return The bitmap's width.
+     */
+
+    const size_t getStride(void) const;
+
+    /**
+     * Use the colors associated with a selected image.
+     *
+     * @param selected.  true: Use colors for a selected widget,
+     *   false: Use normal (default) colors.
+     */
+
+    void setSelected(bool selected);
+
+    /**
+     * Get one row from the bit map image using the selected colors.
+     *
+     * @param x The offset into the row to get
+     * @param y The row number to get
+     * @param width The number of pixels to get from the row
+     * @param data The memory location provided by the caller
+     *   in which to return the data.  This should be at least
+     *   (getWidth()*getBitsPerPixl() + 7)/8 bytes in length
+     *   and properly aligned for the pixel color format.
+     * @param True if the run was returned successfully.
+     */
+
+    bool getRun(nxgl_coord_t x, nxgl_coord_t y, nxgl_coord_t width,
+                FAR void *data);
+  };
+}
+
+#endif // __cplusplus
+
+#endif // __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CCACHEDBITMAP_HXX
@@ -186,7 +186,9 @@ namespace NXWidgets
      * @param width The width of the button.
      * @param height The height of the button.
      * @param normalGlyph Glyph to display when unclicked.
-     * @param clickedGlyph Glyph to display when clicked.
+     * @param clickedGlyph Glyph to display when clicked.  Both glyphs must
+     *   be constant images that are not modified or freed while the button
+     *   exists, because their opaque spans may be cached.
      * @param bitmapX The x coordinate at which the bitmaps will be drawn.
      * @param bitmapY The y coordinate at which the bitmaps will be drawn.
      * @param style The style that the button should use.  If this is not
@@ -207,7 +209,7 @@ namespace NXWidgets
      * Destructor.
      */
 
-    virtual inline ~CGlyphButton(void) { }
+    virtual ~CGlyphButton(void);
 
     /**
      * Insert the dimensions that this widget wants to have into the rect
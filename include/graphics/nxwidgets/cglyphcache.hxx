@@ -0,0 +1,259 @@
+/****************************************************************************
+ * apps/include/graphics/nxwidgets/cglyphcache.hxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CGLYPHCACHE_HXX
+#define __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CGLYPHCACHE_HXX
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <semaphore.h>
+
+#include <nuttx/nx/nxglib.h>
+#include <nuttx/nx/nxfonts.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Implementation Classes
+ ****************************************************************************/
+
+#if defined(__cplusplus)
+
+namespace NXWidgets
+{
+  class  CNxFont;
+  struct SBitmap;
+
+  /**
+   * CGlyphCache holds a bounded number of pre-rendered font glyphs so that
+   * repeatedly drawn text costs only a blit.  Glyphs are keyed by font ID,
+   * character code, foreground color, background color and pixel depth.
+   * When the cache is full, the least recently used glyph is re-used.
+   *
+   * Transparent glyphs are rendered on a background that is the complement
+   * of the foreground color.  Pixels that match the foreground color are
+   * then the glyph pixels and can be merged onto whatever is read back from
+   * the display.
+   *
+   * The cache is shared by all CGraphicsPort instances.  Callers must hold
+   * the cache lock from the call to getGlyph() until they are finished with
+   * the returned glyph memory.
+   */
+
+  class CGlyphCache
+  {
+  private:
+    /**
+     * One cached glyph.  Entries are linked into a hash chain and into a
+     * doubly linked LRU list (most recently used at the head).
+     */
+
+    struct SGlyphEntry
+    {
+      FAR struct SGlyphEntry *flink;      /**< Next (less recently used) entry */
+      FAR struct SGlyphEntry *blink;      /**< Previous (more recently used) entry */
+      FAR struct SGlyphEntry *hnext;      /**< Next entry in the hash chain */
+      FAR uint8_t            *data;       /**< Rendered glyph memory */
+      uint32_t                allocSize;  /**< Size of the glyph memory */
+      uint16_t                stride;     /**< Width of one glyph row in bytes */
+      nxgl_coord_t            width;      /**< Width of the glyph in pixels */
+      nxgl_coord_t            height;     /**< Height of the glyph in rows */
+      nxgl_mxpixel_t          color;      /**< Foreground (font) color */
+      nxgl_mxpixel_t          background; /**< Background color */
+      enum nx_fontid_e        fontId;     /**< Font ID */
+      nxwidget_char_t         letter;     /**< Character code */
+      uint8_t                 bpp;        /**< Bits per pixel */
+      bool                    valid;      /**< True if the entry holds a glyph */
+    };
+
+    FAR struct SGlyphEntry  *m_entries;    /**< Pool of cache entries */
+    FAR struct SGlyphEntry **m_hash;       /**< Hash table of entry chains */
+    FAR struct SGlyphEntry  *m_head;       /**< Most recently used entry */
+    FAR struct SGlyphEntry  *m_tail;       /**< Least recently used entry */
+    uint16_t                 m_nEntries;   /**< Number of entries in the pool */
+    uint32_t                 m_hits;       /**< Number of cache hits */
+    uint32_t                 m_misses;     /**< Number of cache misses */
+    sem_t                    m_sem;        /**< Protects the cache */
+
+    /**
+     * Select the hash chain for a glyph.
+     */
+
+    inline unsigned int hashIndex(enum nx_fontid_e fontId,
+                                  nxwidget_char_t letter,
+                                  nxgl_mxpixel_t color) const
+    {
+      return ((unsigned int)letter + ((unsigned int)fontId << 5) +
+              (unsigned int)color) % m_nEntries;
+    }
+
+    /**
+     * Remove an entry from the LRU list.
+     */
+
+    void unlinkEntry(FAR struct SGlyphEntry *entry);
+
+    /**
+     * Add an entry at the head of the LRU list.
+     */
+
+    void linkEntry(FAR struct SGlyphEntry *entry);
+
+    /**
+     * Remove an entry from its hash chain.
+     */
+
+    void unhashEntry(FAR struct SGlyphEntry *entry);
+
+    /**
+     * Copy constructor is protected to prevent usage.
+     */
+
+    inline CGlyphCache(const CGlyphCache &cache) { }
+
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param nEntries The maximum number of glyphs that will be cached.
+     */
+
+    CGlyphCache(uint16_t nEntries);
+
+    /**
+     * Destructor.
+     */
+
+    ~CGlyphCache(void);
+
+    /**
+     * Get exclusive access to the cache.
+     */
+
+    void lock(void);
+
+    /**
+     * Relinquish exclusive access to the cache.
+     */
+
+    inline void unlock(void)
+    {
+      sem_post(&m_sem);
+    }
+
+    /**
+     * Return a rendered glyph, rendering it into the cache if necessary.
+     * The font color is used as the foreground color of the glyph.  The
+     * caller must hold the cache lock.  The glyph memory remains valid
+     * only until the lock is released.
+     *
+     * @param font The font to render with.
+     * @param letter The character to render.
+     * @param background The background color.  Ignored if transparent is
+     *   true.
+     * @param transparent True if the glyph will be merged onto existing
+     *   display content.
+     * @param bitmap The location to return the description of the glyph.
+     * @return True if the glyph is available; false if memory could not
+     *   be allocated for it.
+     */
+
+    bool getGlyph(CNxFont *font, nxwidget_char_t letter,
+                  nxgl_mxpixel_t background, bool transparent,
+                  FAR struct SBitmap *bitmap);
+
+    /**
+     * Return the background color used to render transparent glyphs
+     * of the given color.
+     *
+     * @param color The foreground color.
+     * @return The background color of the transparent glyph.
+     */
+
+    static inline nxgl_mxpixel_t transparentBackground(nxgl_mxpixel_t color)
+    {
+      return (nxgl_mxpixel_t)(nxwidget_pixel_t)~color;
+    }
+
+    /**
+     * Discard all cached glyphs.  The statistics are not affected.
+     */
+
+    void flush(void);
+
+    /**
+     * Get the number of glyph look-ups that were satisfied by the cache.
+     *
+     * @return The number of cache hits.
+     */
+
+    inline uint32_t getHits(void) const
+    {
+      return m_hits;
+    }
+
+    /**
+     * Get the number of glyph look-ups that required rendering.
+     *
+     * @return The number of cache misses.
+     */
+
+    inline uint32_t getMisses(void) const
+    {
+      return m_misses;
+    }
+
+    /**
+     * Get the maximum number of glyphs that can be held in the cache.
+     *
+     * @return The cache capacity.
+     */
+
+    inline uint16_t getCapacity(void) const
+    {
+      return m_nEntries;
+    }
+
+    /**
+     * Reset the hit and miss counters.
+     */
+
+    inline void resetStatistics(void)
+    {
+      m_hits   = 0;
+      m_misses = 0;
+    }
+  };
+}
+
+#endif // __cplusplus
+
+#endif // __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CGLYPHCACHE_HXX
@@ -66,7 +66,10 @@
 #include <stdint.h>
 #include <stdbool.h>
 
+#include <nuttx/nx/nxglib.h>
+
 #include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/cnxstringview.hxx"
 #include "graphics/nxwidgets/inxwindow.hxx"
 
 /****************************************************************************
@@ -97,23 +100,140 @@ namespace NXWidgets
 #ifdef CONFIG_NX_WRITEONLY
     nxgl_mxpixel_t m_backColor;  /**< The background color to use */
 #endif
+    struct nxgl_rect_s m_clipRect; /**< Window-relative clipping rectangle */
+    bool           m_clipping;   /**< True: Drawing is limited to m_clipRect */
+#ifdef CONFIG_NXWIDGETS_PIXELBUFFER
+    FAR uint8_t   *m_pixelBuffer;     /**< Working buffer for pixel operations */
+    size_t         m_pixelBufferSize; /**< Size of m_pixelBuffer in bytes */
+#endif
+
+    /**
+     * Limit a window-relative rectangle to the clipping rectangle.
+     *
+     * @param rect The rectangle to clip.  Unchanged if no clipping
+     *   rectangle is in effect.
+     * @return False if nothing remains of the rectangle.
+     */
+
+    inline bool clipToPort(FAR struct nxgl_rect_s *rect) const
+    {
+      if (m_clipping)
+        {
+          nxgl_rectintersect(rect, rect, &m_clipRect);
+          return !nxgl_nullrect(rect);
+        }
+
+      return true;
+    }
+
+    /**
+     * Get a working buffer for pixel operations.
+     *
+     * @param size The size of the buffer in bytes.
+     * @return The buffer, or NULL if it could not be allocated.  It must be
+     *   released with freePixelBuffer().
+     */
+
+    FAR uint8_t *allocPixelBuffer(size_t size);
+
+    /**
+     * Release a working buffer returned by allocPixelBuffer().
+     *
+     * @param buffer The buffer to release.
+     */
+
+    void freePixelBuffer(FAR uint8_t *buffer);
+
+    /**
+     * Read a region of the window into a working buffer with a single
+     * request.  The region is limited to the clipping rectangle.
+     *
+     * @param x X coordinate of the region.
+     * @param y Y coordinate of the region.
+     * @param width Width of the region.
+     * @param height Height of the region.
+     * @param rect Receives the window-relative region that was read.
+     * @param stride Receives the length of a row of the buffer in bytes.
+     * @return The buffer, or NULL if nothing is visible or the buffer could
+     *   not be allocated.  The buffer must be passed to writeRegion().
+     */
+
+    FAR uint8_t *readRegion(nxgl_coord_t x, nxgl_coord_t y,
+                            nxgl_coord_t width, nxgl_coord_t height,
+                            FAR struct nxgl_rect_s *rect,
+                            FAR unsigned int *stride);
+
+    /**
+     * Write a region read by readRegion() back to the window with a single
+     * request and release the working buffer.
+     *
+     * @param rect The window-relative region returned by readRegion().
+     * @param buffer The buffer returned by readRegion().
+     * @param stride The length of a row of the buffer in bytes.
+     */
+
+    void writeRegion(FAR const struct nxgl_rect_s *rect,
+                     FAR uint8_t *buffer, unsigned int stride);
 
     /**
      * The underlying implementation for drawText functions
      * @param pos The window-relative x/y coordinate of the string.
      * @param bound The window-relative bounds of the string.
      * @param font The font to draw with.
-     * @param string The string to output.
-     * @param startIndex The start index within the string from which
-     * drawing will commence.
-     * @param length The number of characters to draw.
+     * @param text The characters to output.
      * @param background Color to use for background if transparent is false.
      * @param transparent Whether to fill the background.
      */
 
     void _drawText(struct nxgl_point_s *pos, CRect *bound, CNxFont *font,
-                   const CNxString &string, int startIndex, int length,
-                   nxgl_mxpixel_t background, bool transparent);
+                   const CNxStringView &text, nxgl_mxpixel_t background,
+                   bool transparent);
+
+#ifdef CONFIG_NXWIDGETS_TEXTRUN
+    /**
+     * Compose the visible part of a string in an off-screen row buffer and
+     * send it to the window with a single bitmap operation.
+     *
+     * @param pos The window-relative x/y coordinate of the string.  On
+     *   return, the x coordinate is advanced past the string.
+     * @param bound The window-relative bounds of the string.
+     * @param font The font to draw with.
+     * @param text The characters to output.
+     * @param glyph Working memory large enough to hold the largest glyph.
+     * @param background Color to use for background if transparent is false.
+     * @param transparent Whether to fill the background.
+     * @return False if the row buffer could not be allocated.  Nothing is
+     *   drawn in that case.
+     */
+
+    bool _drawTextRun(struct nxgl_point_s *pos,
+                      FAR const struct nxgl_rect_s *bound, CNxFont *font,
+                      const CNxStringView &text, FAR uint8_t *glyph, nxgl_mxpixel_t background,
+                      bool transparent);
+#endif
+
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+    /**
+     * Draw one character using the shared glyph cache.
+     *
+     * @param pos The window-relative x/y coordinate of the character.
+     * @param dest The window-relative bounding box of the character.
+     * @param clip The part of dest that is to be drawn.
+     * @param font The font to draw with.
+     * @param letter The character to draw.
+     * @param bitmap Working memory large enough to hold the character.
+     * @param background Color to use for background if transparent is false.
+     * @param transparent Whether to fill the background.
+     * @return False if the glyph cache could not provide the character.
+     */
+
+    bool _drawCachedChar(FAR const struct nxgl_point_s *pos,
+                         FAR const struct nxgl_rect_s *dest,
+                         FAR const struct nxgl_rect_s *clip,
+                         CNxFont *font, nxwidget_char_t letter,
+                         FAR struct SBitmap *bitmap,
+                         nxgl_mxpixel_t background, bool transparent);
+#endif
 
   public:
     /**
@@ -137,6 +257,19 @@ namespace NXWidgets
 
     virtual ~CGraphicsPort();
 
+    /**
+     * Change the window that this port draws to.  This allows the same
+     * port instance to be kept when drawing is redirected (for example, to
+     * or from a back buffer), so that references to the port stay valid.
+     *
+     * @param pNxWnd. The new underlying window.
+     */
+
+    inline void setWindow(INxWindow *pNxWnd)
+    {
+      m_pNxWnd = pNxWnd;
+    }
+
     /**
      * Return the absolute x coordinate of the upper left hand corner of the
      * underlying window.
@@ -185,6 +318,47 @@ namespace NXWidgets
     }
 #endif
 
+    /**
+     * Limit all subsequent drawing to a region of the window.  Lines and
+     * circles that cross the edge of the region are drawn whole; all
+     * other operations except copy() and move() are clipped exactly.
+     *
+     * @param rect The window-relative clipping rectangle.
+     */
+
+    void setClipRect(const CRect &rect);
+
+    /**
+     * Remove the clipping rectangle so that drawing may again affect the
+     * whole window.
+     */
+
+    inline void clearClipRect(void)
+    {
+      m_clipping = false;
+    }
+
+    /**
+     * Check if a clipping rectangle is in effect.
+     *
+     * @return True if drawing is limited to a clipping rectangle.
+     */
+
+    inline bool isClipping(void) const
+    {
+      return m_clipping;
+    }
+
+    /**
+     * Get the clipping rectangle.
+     *
+     * @param rect Reference to a rect to populate with the window-relative
+     *   clipping rectangle.  Unchanged if no clipping is in effect.
+     * @return True if drawing is limited to a clipping rectangle.
+     */
+
+    bool getClipRect(CRect &rect) const;
+
     /**
      * Draw a pixel into the window.
      *
@@ -288,11 +462,8 @@ namespace NXWidgets
      * @param color The color of the rectangle.
      */
 
-    inline void drawFilledCircle(struct nxgl_point_s *center, nxgl_coord_t radius,
-                                 nxgl_mxpixel_t color)
-    {
-      m_pNxWnd->drawFilledCircle(center, radius, color);
-    }
+    void drawFilledCircle(struct nxgl_point_s *center, nxgl_coord_t radius,
+                          nxgl_mxpixel_t color);
 
     /**
      * Draw a string to the window.
@@ -353,6 +524,44 @@ namespace NXWidgets
                   const CNxString &string, int startIndex, int length,
                   nxgl_mxpixel_t color, nxgl_mxpixel_t background);
 
+    /**
+     * Draw a string view to the window.  A view of part of a string can be
+     * drawn without copying it.
+     * @param pos The window-relative x/y coordinate of the string.
+     * @param bound The window-relative bounds of the string.
+     * @param font The font to draw with.
+     * @param text The characters to output.
+     */
+
+    void drawText(struct nxgl_point_s *pos, CRect *bound, CNxFont *font,
+                  const CNxStringView &text);
+
+    /**
+     * Draw a string view to the window in a specific color.
+     * @param pos The window-relative x/y coordinate of the string.
+     * @param bound The window-relative bounds of the string.
+     * @param font The font to draw with.
+     * @param text The characters to output.
+     * @param color The color of the string.
+     */
+
+    void drawText(struct nxgl_point_s *pos, CRect *bound, CNxFont *font,
+                  const CNxStringView &text, nxgl_mxpixel_t color);
+
+    /**
+     * Draw a string view to the window and fill the background in one go.
+     * @param pos The window-relative x/y coordinate of the string.
+     * @param bound The window-relative bounds of the string.
+     * @param font The font to draw with.
+     * @param text The characters to output.
+     * @param color Foreground color
+     * @param background Background color
+     */
+
+    void drawText(struct nxgl_point_s *pos, CRect *bound, CNxFont *font,
+                  const CNxStringView &text, nxgl_mxpixel_t color,
+                  nxgl_mxpixel_t background);
+
     /**
      * Draw an opaque bitmap to the window.
      *
@@ -385,12 +594,15 @@ namespace NXWidgets
      * @param bitmapY The window-relative y coordinate within the supplied bitmap to use as
      * the origin.
      * @param transparentColor The transparent color used in the bitmap.
+     * @param constant True if the bitmap is a constant image (such as a
+     *   glyph) whose memory is never modified or freed while it is in use.
+     *   Only constant bitmaps are drawn from the span cache.
      */
 
     void drawBitmap(nxgl_coord_t x, nxgl_coord_t y,
                     nxgl_coord_t width, nxgl_coord_t height,
                     const struct SBitmap *bitmap, int bitmapX, int  bitmapY,
-                    nxgl_mxpixel_t transparentColor);
+                    nxgl_mxpixel_t transparentColor, bool constant = false);
 
     /**
      * Draw a bitmap to the port in greyscale.
@@ -454,10 +666,10 @@ namespace NXWidgets
                    nxgl_coord_t width, nxgl_coord_t height);
 
     /**
-     * Invert colors in a region.  NOTE:  This allocates an in-memory
-     * buffer the size of one row in graphic memory.  So it may only be
-     * useful for inverting small regions and its only current use is for
-     * the inverted cursor text.
+     * Invert colors in a region.  NOTE:  This needs an in-memory buffer
+     * the size of the whole region.  So it may only be useful for
+     * inverting small regions and its only current use is for the
+     * inverted cursor text.
      *
      * @param x X coordinate of the region to change.
      * @param y Y coordinate of the region to change.
@@ -99,6 +99,29 @@ namespace NXWidgets
     FAR IBitmap        *m_bitmap;      /**< Source bitmap image */
     struct nxgl_point_s m_origin;      /**< Origin for offset image display position */
     bool                m_highlighted; /**< Image is highlighted */
+#ifdef CONFIG_NXWIDGETS_IMAGECACHE
+    FAR nxwidget_pixel_t *m_cache;     /**< Converted image, or NULL */
+    FAR IBitmap        *m_cacheBitmap; /**< Bitmap that m_cache was built from */
+    struct nxgl_point_s m_cacheOrigin; /**< Image origin that m_cache was built with */
+    nxgl_coord_t        m_cacheWidth;  /**< Width of m_cache in pixels */
+    nxgl_coord_t        m_cacheHeight; /**< Height of m_cache in rows */
+    nxwidget_pixel_t    m_cacheBackColor; /**< Background color of m_cache */
+    bool                m_cacheSelected; /**< m_cache holds the selected image */
+    bool                m_cacheEnabled;  /**< m_cache holds the enabled image */
+
+    /**
+     * Draw the widget contents from the cached, converted image.  The cache
+     * is rebuilt first if the bitmap, the image position, the widget size or
+     * the state have changed since it was built.
+     * @param port The CGraphicsPort to draw to.
+     * @param rect The drawable region of the widget.
+     * @param selected True if the image is drawn selected.
+     * @return False if the cache could not be built.
+     */
+
+    bool drawCachedContents(CGraphicsPort *port, const CRect &rect,
+                            bool selected);
+#endif
 
     /**
      * Draw the area of this widget that falls within the clipping region.
@@ -210,7 +233,12 @@ namespace NXWidgets
      * container is destroyed.
      */
 
-    virtual inline ~CImage() { }
+    virtual inline ~CImage()
+    {
+#ifdef CONFIG_NXWIDGETS_IMAGECACHE
+      delete[] m_cache;
+#endif
+    }
 
     /**
      * Get pointer to the bitmap that this image contains.
@@ -222,7 +250,23 @@ namespace NXWidgets
      * Set the bitmap that this image contains.
      */
 
-    inline void setBitmap(FAR IBitmap *bitmap) { m_bitmap = bitmap; }
+    inline void setBitmap(FAR IBitmap *bitmap)
+    {
+      m_bitmap = bitmap;
+      invalidateImageCache();
+    }
+
+    /**
+     * Discard the cached, converted image.  This must be called if the
+     * contents of the bitmap change while it is shown by the image.
+     */
+
+    inline void invalidateImageCache(void)
+    {
+#ifdef CONFIG_NXWIDGETS_IMAGECACHE
+      m_cacheBitmap = (FAR IBitmap *)0;
+#endif
+    }
 
     /**
      * Insert the dimensions that this widget wants to have into the rect
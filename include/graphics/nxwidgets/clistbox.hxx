@@ -155,6 +155,19 @@ namespace NXWidgets
 
     virtual void setOptionSelected(const int index, const bool selected);
 
+    /**
+     * Get the position of an option relative to the top of the visible
+     * part of the list.
+     *
+     * @param index The index of the option.
+     * @return The y coordinate of the top of the option.
+     */
+
+    inline const int32_t getOptionY(const int index) const
+    {
+      return m_canvasY + index * (int32_t)getOptionHeight();
+    }
+
     /**
      * Copy constructor is protected to prevent usage.
      */
@@ -279,6 +292,14 @@ namespace NXWidgets
 
     virtual const int getSelectedIndex(void) const;
 
+    /**
+     * Get the number of selected options.
+     *
+     * @return The number of selected options.
+     */
+
+    virtual const int getSelectedCount(void) const;
+
     /**
      * Sets the selected index.  Specify -1 to select nothing.  Resets any
      * other selected options to deselected. Redraws the widget and raises
@@ -100,6 +100,9 @@ namespace NXWidgets
                                            be selected. */
     bool m_sortInsertedItems;         /**< Automatically sorts items on
                                            insertion if true. */
+    int m_selectedCount;              /**< Number of selected items. */
+    int m_firstSelected;              /**< Index of the first selected item,
+                                           or -1 if no item is selected. */
 
     /**
      * Quick sort the items using their compareTo() methods.
@@ -128,17 +131,42 @@ namespace NXWidgets
 
     const int getSortedInsertionIndex(const CListDataItem *item) const;
 
+    /**
+     * Select or deselect a single item, keeping the count and the index of
+     * the first selected item up to date.  Raises no events.
+     *
+     * @param index The index of the item.
+     * @param selected True to select the item, false to deselect it.
+     */
+
+    void setSelectionState(const int index, const bool selected);
+
+    /**
+     * Find the first selected item at or after the specified index.
+     *
+     * @param start The index to start searching from.
+     * @return The index of the selected item, or -1 if there is none.
+     */
+
+    const int findSelectedItem(const int start) const;
+
     /**
      * Raise a data changed event.
+     *
+     * @param index The index of the only item that changed, or -1 if any
+     *   number of items may have changed.
      */
 
-    void raiseDataChangedEvent(void);
+    void raiseDataChangedEvent(const int index = -1);
 
     /**
      * Raise a selection changed event.
+     *
+     * @param index The index of the only item whose selection changed, or
+     *   -1 if any number of items may have changed.
      */
 
-    void raiseSelectionChangedEvent(void);
+    void raiseSelectionChangedEvent(const int index = -1);
 
   public:
 
@@ -209,6 +237,17 @@ namespace NXWidgets
 
     virtual const int getSelectedIndex(void) const;
 
+    /**
+     * Get the number of selected items.
+     *
+     * @return The number of selected items.
+     */
+
+    inline const int getSelectedCount(void) const
+    {
+      return m_selectedCount;
+    }
+
     /**
      * Sets the selected index.  Specify -1 to select nothing.  Resets any
      * other selected items to deselected.
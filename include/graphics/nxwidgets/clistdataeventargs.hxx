@@ -89,16 +89,37 @@ namespace NXWidgets
 
   class CListDataEventArgs : public TEventArgs<CListData*>
   {
+  private:
+    int m_index; /**< Index of the item affected by the event */
+
   public:
 
     /**
      * Constructor.
      *
      * @param source Pointer to the CListData object that raised the event.
+     * @param index The index of the only item affected by the event, or -1
+     *   if any number of items may have been affected.
+     */
+
+    inline CListDataEventArgs(CListData *source, int index = -1)
+    : TEventArgs<CListData*>(source)
+    {
+      m_index = index;
+    }
+
+    /**
+     * Get the index of the item affected by the event.  For an item that
+     * was removed, this is the index that the item had before it was
+     * removed.
+     *
+     * @return The index of the only affected item, or -1 if any number
+     *   of items may have been affected.
      */
 
-    inline CListDataEventArgs(CListData *source) : TEventArgs<CListData*>(source)
+    inline const int getIndex(void) const
     {
+      return m_index;
     }
   };
 }
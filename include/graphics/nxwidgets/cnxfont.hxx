@@ -34,6 +34,7 @@
 #include <nuttx/nx/nxfonts.h>
 
 #include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/cnxstringview.hxx"
 
 /****************************************************************************
  * Pre-Processor Definitions
@@ -62,6 +63,20 @@ namespace NXWidgets
     FAR const struct nx_font_s *m_pFontSet; /** < The font set metrics */
     nxgl_mxpixel_t m_fontColor;             /**< Color to draw the font with when rendering. */
     nxgl_mxpixel_t m_transparentColor;      /**< Background color that should not be rendered. */
+#ifdef CONFIG_NXWIDGETS_FONTWIDTHS
+    uint8_t m_charWidths[256];              /**< Advance width of each 8-bit character */
+#endif
+
+    /**
+     * Get the width of a run of characters in pixels.
+     *
+     * @param text The first character of the run.
+     * @param length The number of characters in the run.
+     * @return The width of the run in pixels.
+     */
+
+    nxgl_coord_t getRunWidth(FAR const nxwidget_char_t *text,
+                             int length) const;
 
   public:
 
@@ -93,6 +108,17 @@ namespace NXWidgets
 
     const bool isCharBlank(const nxwidget_char_t letter) const;
 
+    /**
+     * Gets the ID of the font.
+     *
+     * @return The font ID.
+     */
+
+    inline const enum nx_fontid_e getFontId() const
+    {
+      return m_fontId;
+    }
+
     /**
      * Gets the color currently being used as the drawing color.
      *
@@ -178,6 +204,18 @@ namespace NXWidgets
       return getStringWidth(*text, startIndex, length);
     }
 
+    /**
+     * Get the width of a string view in pixels when drawn with this font.
+     *
+     * @param text The characters to check.
+     * @return The width of the characters in pixels.
+     */
+
+    inline nxgl_coord_t getStringWidth(const CNxStringView &text) const
+    {
+      return getRunWidth(text.getCharArray(), text.getLength());
+    }
+
     /**
      * Gets font metrics for a particular character
      *
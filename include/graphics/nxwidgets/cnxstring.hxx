@@ -68,6 +68,7 @@
 #include <stdbool.h>
 
 #include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/cnxstringview.hxx"
 
 /****************************************************************************
  * Pre-Processor Definitions
@@ -99,6 +100,10 @@ namespace NXWidgets
    * time it needs to allocate extra memory, potentially reducing the number
    * of reallocs needed.
    *
+   * If CONFIG_NXWIDGETS_STRINGINLINE is selected, strings of up to
+   * CONFIG_NXWIDGETS_STRINGINLINE_SIZE characters are held within the
+   * object itself and do not use the heap at all.
+   *
    * The string is not null-terminated.  Instead, it uses a m_stringLength
    * member that stores the number of characters in the string.  This saves a
    * byte and makes calls to getLength() run in O(1) time instead of O(n).
@@ -113,10 +118,49 @@ namespace NXWidgets
     int m_allocatedSize; /**< Number of bytes allocated for this string */
     int m_growAmount;    /**< Number of chars that the string grows by
                               whenever it needs to get larger */
+    int m_headroom;      /**< Number of chars released from the front of
+                              the allocation by remove() */
 
 
   protected:
     FAR nxwidget_char_t *m_text;  /**< Raw char array data */
+#ifdef CONFIG_NXWIDGETS_STRINGINLINE
+    nxwidget_char_t m_inline[CONFIG_NXWIDGETS_STRINGINLINE_SIZE]; /**< Storage for short strings */
+#endif
+
+    /**
+     * Initialize an empty string.  Used by the constructors.
+     */
+
+    void initialize(void);
+
+    /**
+     * Check if the string data is held on the heap.
+     *
+     * @return True if m_text must be deleted.
+     */
+
+    inline bool isAllocated(void) const
+    {
+#ifdef CONFIG_NXWIDGETS_STRINGINLINE
+      return m_text != (FAR nxwidget_char_t *)0 && getAllocation() != m_inline;
+#else
+      return m_text != (FAR nxwidget_char_t *)0;
+#endif
+    }
+
+    /**
+     * Get the start of the memory holding the string.  This differs from
+     * m_text once characters have been removed from the front of the
+     * string.
+     *
+     * @return The start of the string memory.
+     */
+
+    inline FAR nxwidget_char_t *getAllocation(void) const
+    {
+      return m_text - m_headroom;
+    }
 
     /**
      * Allocate memory for the string.
@@ -202,13 +246,34 @@ namespace NXWidgets
 
     CNxString(const CNxString &string);
 
+    /**
+     * Move constructor.  The memory of the argument string is taken over
+     * and the argument string is left empty.
+     *
+     * @param string CNxString object to move from.
+     */
+
+    CNxString(CNxString &&string);
+
+    /**
+     * Constructor to create a string from a string view.
+     *
+     * @param view The characters to copy.
+     */
+
+    explicit CNxString(const CNxStringView &view);
+
     /**
      * Destructor.
      */
 
     virtual inline ~CNxString()
     {
-      delete[] m_text;
+      if (isAllocated())
+        {
+          delete[] getAllocation();
+        }
+
       m_text = NULL;
     };
 
@@ -272,6 +337,17 @@ namespace NXWidgets
 
     void setText(const nxwidget_char_t text);
 
+    /**
+     * Set the text in the string.
+     *
+     * @param view The characters to use as the new data for this string.
+     */
+
+    inline void setText(const CNxStringView &view)
+    {
+      setText(view.getCharArray(), view.getLength());
+    }
+
     /**
      * Append text to the end of the string.
      *
@@ -299,7 +375,8 @@ namespace NXWidgets
 
     /**
      * Remove specified number of characters from the string from the
-     * start index onwards.
+     * start index onwards.  Removing characters from the start of the
+     * string does not move the remaining characters.
      *
      * @param startIndex Index to remove from.
      * @param count Number of characters to remove.
@@ -438,6 +515,33 @@ namespace NXWidgets
 
     FAR CNxString *subString(int startIndex, int length) const;
 
+    /**
+     * Get a view of the whole string.  No memory is allocated.  The view
+     * is valid only until this string is modified or destroyed.
+     *
+     * @return A view of the string.
+     */
+
+    inline CNxStringView getView(void) const
+    {
+      return CNxStringView(m_text, m_stringLength);
+    }
+
+    /**
+     * Get a view of a substring of this string.  No memory is allocated.
+     * The range is clipped to the string.  The view is valid only until
+     * this string is modified or destroyed.
+     *
+     * @param startIndex The starting point of the substring.
+     * @param length The length of the substring.
+     * @return A view of the substring.
+     */
+
+    inline CNxStringView subStringView(int startIndex, int length) const
+    {
+      return getView().subView(startIndex, length);
+    }
+
     /**
      * Overloaded assignment operator.  Copies the data within the argument
      * string to this string.
@@ -448,6 +552,16 @@ namespace NXWidgets
 
     CNxString &operator=(const CNxString &string);
 
+    /**
+     * Overloaded move assignment operator.  The memory of the argument
+     * string is taken over and the argument string is left empty.
+     *
+     * @param string The string to move from.
+     * @return This string.
+     */
+
+    CNxString &operator=(CNxString &&string);
+
     /**
      * Overloaded assignment operator.  Copies the data within the argument
      * char array to this string.
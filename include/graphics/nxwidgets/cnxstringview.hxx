@@ -0,0 +1,156 @@
+/****************************************************************************
+ * apps/include/graphics/nxwidgets/cnxstringview.hxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CNXSTRINGVIEW_HXX
+#define __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CNXSTRINGVIEW_HXX
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Implementation Classes
+ ****************************************************************************/
+
+#if defined(__cplusplus)
+
+namespace NXWidgets
+{
+  /**
+   * A read-only view of a run of characters, normally a part of a
+   * CNxString.  A view does not own or copy the characters, so taking a
+   * substring as a view never allocates memory.  The view is valid only
+   * until the string that it refers to is modified or destroyed.
+   */
+
+  class CNxStringView
+  {
+  private:
+    FAR const nxwidget_char_t *m_text; /**< First character of the view */
+    int m_length;                      /**< Number of characters in the view */
+
+  public:
+
+    /**
+     * Constructor to create an empty view.
+     */
+
+    inline CNxStringView(void)
+    {
+      m_text   = (FAR const nxwidget_char_t *)0;
+      m_length = 0;
+    }
+
+    /**
+     * Constructor to create a view of a character array.
+     *
+     * @param text The first character of the view.
+     * @param length The number of characters in the view.
+     */
+
+    inline CNxStringView(FAR const nxwidget_char_t *text, int length)
+    {
+      m_text   = text;
+      m_length = length > 0 ? length : 0;
+    }
+
+    /**
+     * Get the number of characters in the view.
+     *
+     * @return The length of the view.
+     */
+
+    inline const unsigned int getLength(void) const
+    {
+      return m_length;
+    }
+
+    /**
+     * Returns a pointer to the first character of the view.  The
+     * characters are not null-terminated.
+     *
+     * @return Pointer to the char array.
+     */
+
+    inline FAR const nxwidget_char_t *getCharArray(void) const
+    {
+      return m_text;
+    }
+
+    /**
+     * Get the character at the specified index.
+     *
+     * @param index The index of the character to retrieve.
+     * @return The character at the specified index, or zero if the index
+     *   is outside of the view.
+     */
+
+    inline const nxwidget_char_t getCharAt(int index) const
+    {
+      return (unsigned int)index < (unsigned int)m_length ?
+             m_text[index] : (nxwidget_char_t)0;
+    }
+
+    /**
+     * Get a view of part of this view.  The range is clipped to the view.
+     *
+     * @param startIndex The starting point of the sub-view.
+     * @param length The length of the sub-view.
+     * @return The sub-view.
+     */
+
+    inline CNxStringView subView(int startIndex, int length) const
+    {
+      if (startIndex < 0)
+        {
+          length    += startIndex;
+          startIndex = 0;
+        }
+
+      if (startIndex > m_length)
+        {
+          startIndex = m_length;
+        }
+
+      if (length > m_length - startIndex)
+        {
+          length = m_length - startIndex;
+        }
+
+      return CNxStringView(m_text + startIndex, length);
+    }
+  };
+}
+
+#endif // __cplusplus
+
+#endif // __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CNXSTRINGVIEW_HXX
@@ -92,16 +92,26 @@ namespace NXWidgets
    *  - Create an instance of the CNxTimer and add it as a child to a widget.
    *  - Call the instance's "start()" method.
    *  - Catch the timer's action event and call any code that should run.
+   *
+   * With CONFIG_NXWIDGETS_TIMERQUEUE, all of the timers of a window share
+   * the window's CTimerQueue instead of each queuing its own work.
    */
 
   class CNxTimer : public CNxWidget
   {
   protected:
+#ifdef CONFIG_NXWIDGETS_TIMERQUEUE
+    friend class CTimerQueue;
+
+    clock_t           m_deadline;   /**< System time when the timer fires */
+#else
     struct work_s     m_work;       /**< Work queue entry */
+#endif
     uint32_t          m_timeout;    /**< The timeout value in milliseconds */
     bool              m_isRunning;  /**< Indicates whether or not the timer is running */
     bool              m_isRepeater; /**< Indicates whether or not the timer repeats */
 
+#ifndef CONFIG_NXWIDGETS_TIMERQUEUE
     /**
      * Static function called from work queue when the timeout expires.
      *
@@ -109,6 +119,7 @@ namespace NXWidgets
      */
 
     static void workQueueCallback(FAR void *arg);
+#endif
 
     /**
      * Copy constructor is protected to prevent usage.
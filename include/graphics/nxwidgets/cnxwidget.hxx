@@ -1005,6 +1005,26 @@ namespace NXWidgets
 
     void redraw(void);
 
+    /**
+     * Draws the parts of the widget and of its child widgets that intersect
+     * a region of the window.  Widgets that do not intersect the region are
+     * skipped.  The caller is responsible for clipping the graphics port to
+     * the region.
+     *
+     * @param rect The window-relative region to redraw.
+     */
+
+    void redrawRegion(const CRect &rect);
+
+    /**
+     * Marks the widget as needing to be redrawn.  With
+     * CONFIG_NXWIDGETS_DAMAGE, the widget's area is added to the window's
+     * damaged regions and is redrawn on the next event poll, together with
+     * any other changes.  Otherwise, the widget is redrawn immediately.
+     */
+
+    void invalidate(void);
+
     /**
      * Enables the widget.
      *
@@ -1234,6 +1254,16 @@ namespace NXWidgets
 
     bool checkCollision(CNxWidget *widget) const;
 
+    /**
+     * Checks if any visible widget that is drawn after this widget overlaps
+     * it.  If not, the pixels of the widget in the window belong only to
+     * this widget and its children.
+     *
+     * @return True if the widget may be partly covered by another widget.
+     */
+
+    bool isObscured(void) const;
+
     /**
      * Adds a widget to this widget's child stack.  The widget is added to the
      * top of the stack.  Note that the widget can only be added if it is not
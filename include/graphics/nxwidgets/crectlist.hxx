@@ -0,0 +1,165 @@
+/****************************************************************************
+ * apps/include/graphics/nxwidgets/crectlist.hxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CRECTLIST_HXX
+#define __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CRECTLIST_HXX
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/crect.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Implementation Classes
+ ****************************************************************************/
+
+#if defined(__cplusplus)
+
+namespace NXWidgets
+{
+  /**
+   * CRectList holds a bounded set of non-overlapping rectangles describing
+   * the parts of a window that need attention (damaged or dirty regions).
+   * A rectangle that overlaps or touches rectangles already in the list is
+   * merged with them.  When the list is full, the new rectangle is merged
+   * with the rectangle whose bounding box grows the least.
+   *
+   * CRectList provides no locking of its own.
+   */
+
+  class CRectList
+  {
+  private:
+    FAR CRect *m_rects;     /**< The rectangles */
+    uint8_t    m_nRects;    /**< Number of rectangles in the list */
+    uint8_t    m_maxRects;  /**< Maximum number of rectangles */
+
+    /**
+     * Remove a rectangle from the list.  The last rectangle takes its place.
+     *
+     * @param index The index of the rectangle to remove.
+     */
+
+    inline void removeRect(int index)
+    {
+      m_rects[index] = m_rects[--m_nRects];
+    }
+
+    /**
+     * Copy constructor is protected to prevent usage.
+     */
+
+    inline CRectList(const CRectList &list) { }
+
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param maxRects The maximum number of separate rectangles.
+     */
+
+    CRectList(uint8_t maxRects);
+
+    /**
+     * Destructor.
+     */
+
+    ~CRectList(void);
+
+    /**
+     * Add a rectangle to the list, merging it with any rectangles that it
+     * overlaps or touches.  Empty rectangles are ignored.
+     *
+     * @param rect The rectangle to add.
+     */
+
+    void addRect(const CRect &rect);
+
+    /**
+     * Get the number of rectangles in the list.
+     *
+     * @return The number of rectangles.
+     */
+
+    inline int getRectCount(void) const
+    {
+      return m_nRects;
+    }
+
+    /**
+     * Get the maximum number of rectangles in the list.
+     *
+     * @return The list capacity.
+     */
+
+    inline int getCapacity(void) const
+    {
+      return m_maxRects;
+    }
+
+    /**
+     * Get one rectangle from the list.
+     *
+     * @param index The index of the rectangle.
+     * @return The rectangle.
+     */
+
+    inline const CRect &getRect(int index) const
+    {
+      return m_rects[index];
+    }
+
+    /**
+     * Check if the list is empty.
+     *
+     * @return True if there are no rectangles in the list.
+     */
+
+    inline bool isEmpty(void) const
+    {
+      return m_nRects == 0;
+    }
+
+    /**
+     * Remove all rectangles from the list.
+     */
+
+    inline void clear(void)
+    {
+      m_nRects = 0;
+    }
+  };
+}
+
+#endif // __cplusplus
+
+#endif // __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CRECTLIST_HXX
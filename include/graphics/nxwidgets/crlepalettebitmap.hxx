@@ -75,6 +75,17 @@ namespace NXWidgets
      */
 
     FAR const struct SRlePaletteBitmapEntry *data;
+
+#ifdef CONFIG_NXWIDGETS_RLEEXPANDED
+    /**
+     * Pointers to the complete image already expanded into the display
+     * format using each LUT, or NULL if the image was generated without
+     * the expanded copies.  CRlePaletteBitmap then expands the image into
+     * RAM when it is first drawn.
+     */
+
+    FAR const void *pixels[2];
+#endif
   };
 
   /**
@@ -98,8 +109,48 @@ namespace NXWidgets
     nxgl_coord_t     m_col;       /**< Logical column number */
     uint8_t          m_remaining; /**< Number of bytes remaining in current entry */
     FAR const void  *m_lut;       /**< The selected LUT */
+#ifdef CONFIG_NXWIDGETS_RLEEXPANDED
+    FAR const void  *m_pixels;    /**< The selected expanded image (may be NULL) */
+    FAR nxwidget_pixel_t *m_expanded[2]; /**< Images expanded from the RLE data */
+    bool             m_selected;  /**< True: The selected LUT is in use */
+#endif
     FAR const struct SRlePaletteBitmapEntry *m_rle; /**< RLE entry being processed */
 
+#ifdef CONFIG_NXWIDGETS_RLEINDEX
+    /**
+     * The decoder position at the beginning of an indexed row
+     */
+
+    struct SRleRowStart
+    {
+      FAR const struct SRlePaletteBitmapEntry *rle; /**< RLE entry holding the first pixel */
+      uint8_t          remaining;                   /**< Pixels remaining in that entry */
+    };
+
+    FAR struct SRleRowStart *m_index; /**< Start of every CONFIG_NXWIDGETS_RLEINDEX_INTERVAL rows */
+
+    /**
+     * Build the row index by decoding the image once.  The current
+     * position is lost.
+     *
+     * @return False if the index could not be allocated
+     */
+
+    bool buildIndex(void);
+#endif
+
+#ifdef CONFIG_NXWIDGETS_RLEEXPANDED
+    /**
+     * Expand the complete image using the selected LUT by decoding the RLE
+     * data once.  This is used for images that were generated without
+     * expanded copies.  The current position is lost.
+     *
+     * @return False if the expanded image could not be allocated
+     */
+
+    bool expandImage(void);
+#endif
+
     /**
      * Reset to the beginning of the image
      */
@@ -165,6 +216,15 @@ namespace NXWidgets
 
     bool copyPixels(nxgl_coord_t npixels, FAR void *data);
 
+    /**
+     * Copy constructor and assignment are protected to prevent usage.  A
+     * copy would share, and then free again, the row index and the
+     * expanded images.  They are not implemented.
+     */
+
+    CRlePaletteBitmap(const CRlePaletteBitmap &bitmap);
+    CRlePaletteBitmap &operator=(const CRlePaletteBitmap &bitmap);
+
   public:
 
     /**
@@ -179,7 +239,7 @@ namespace NXWidgets
      * Destructor.
      */
 
-    inline ~CRlePaletteBitmap(void) {}
+    ~CRlePaletteBitmap(void);
 
     /**
      * Get the bitmap's color format.
@@ -57,13 +57,38 @@ namespace NXWidgets
   class CScaledBitmap : public IBitmap
   {
   protected:
+    /**
+     * Describes how one column of the scaled image is interpolated from the
+     * contained bitmap.
+     */
+
+    struct SScaledColumn
+    {
+      nxgl_coord_t col1;   /**< Column at or just before the position */
+      nxgl_coord_t col2;   /**< The following column (clipped to the image) */
+      uint8_t      weight; /**< Weight of col2 in units of 1/256 */
+    };
+
     FAR IBitmap       *m_bitmap;      /**< The bitmap that is being scaled */
     struct nxgl_size_s m_size;        /**< Scaled size of the image */
     FAR uint8_t       *m_rowCache[2]; /**< Two cached rows of the image */
+    FAR struct SScaledColumn *m_columns; /**< Interpolation of each scaled column */
+#ifdef CONFIG_NXWIDGETS_SCALEDCACHE
+    FAR uint8_t       *m_frame;       /**< The complete scaled image */
+#endif
     unsigned int       m_row;         /**< Row number of the first cached row */
     b16_t              m_xScale;      /**< X scale factor */
     b16_t              m_yScale;      /**< Y scale factor */
 
+    /**
+     * Compute the scale factors and the column table for the current
+     * scaled size.
+     *
+     * @return True if the column table was allocated.
+     */
+
+    bool setScale(void);
+
     /**
      * Read two rows into the row cache
      *
@@ -73,31 +98,28 @@ namespace NXWidgets
     bool cacheRows(unsigned int row);
 
     /**
-     * Given an two RGB colors and a fractional value, return the scaled
-     * value between the two colors.
+     * Interpolate part of one row of the scaled image.  The caller has
+     * verified the ranges.
      *
-     * @param incolor1 - The first color to be used
-     * @param incolor2 - The second color to be used
-     * @param fraction - The fractional value
-     * @param outcolor - The returned, scaled color
+     * @param x The offset into the row to get
+     * @param y The row number to get
+     * @param width The number of pixels to get from the row
+     * @param data The memory location in which to return the data
+     * @return True if the run was returned successfully.
      */
 
-    bool scaleColor(FAR const struct rgbcolor_s &incolor1,
-                    FAR const struct rgbcolor_s &incolor2,
-                    b16_t fraction, FAR struct rgbcolor_s &outcolor);
+    bool scaleRun(nxgl_coord_t x, nxgl_coord_t y, nxgl_coord_t width,
+                  FAR void *data);
 
+#ifdef CONFIG_NXWIDGETS_SCALEDCACHE
     /**
-     * Given an image row and a non-integer column offset, return the
-     * interpolated RGB color value corresponding to that position
-     *
-     * @param row - The pointer to the row in the row cache to use
-     * @param column - The non-integer column offset
-     * @param outcolor - The returned, interpolated color
+     * Scale the complete image into the frame cache.
      *
+     * @return True if the frame cache is available.
      */
 
-    bool rowColor(FAR uint8_t *row, b16_t column,
-                  FAR struct rgbcolor_s &outcolor);
+    bool buildFrame(void);
+#endif
 
     /**
      * Copy constructor is protected to prevent usage.
@@ -171,6 +193,16 @@ namespace NXWidgets
 
     inline void setSelected(bool selected) {}
 
+    /**
+     * Change the scaled size of the image.  Any cached scaled image is
+     * discarded.
+     *
+     * @param newSize The new, scaled size of the image
+     * @return True if the size was changed successfully.
+     */
+
+    bool setSize(const struct nxgl_size_s &newSize);
+
     /**
      * Get one row from the bit map image.
      *
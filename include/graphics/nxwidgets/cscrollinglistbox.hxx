@@ -262,6 +262,17 @@ namespace NXWidgets
       return m_listbox->getSelectedIndex();
     }
 
+    /**
+     * Get the number of selected options.
+     *
+     * @return The number of selected options.
+     */
+
+    virtual inline const int getSelectedCount(void) const
+    {
+      return m_listbox->getSelectedCount();
+    }
+
     /**
      * Sets the selected index.  Specify -1 to select nothing.  Resets any
      * other selected items to deselected.
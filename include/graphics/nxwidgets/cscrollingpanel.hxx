@@ -160,6 +160,18 @@ namespace NXWidgets
 
     void scrollChildren(int32_t dx, int32_t dy, bool do_redraw);
 
+    /**
+     * Move the visible contents of the panel by the specified amounts and
+     * redraw the regions revealed by the move.  The whole panel is redrawn
+     * instead if nothing remains visible after the move or if the pixels
+     * of the panel cannot safely be copied.
+     *
+     * @param dx The horizontal distance to scroll.
+     * @param dy The vertical distance to scroll.
+     */
+
+    void scrollContents(int32_t dx, int32_t dy);
+
     /**
      * Destructor.
      */
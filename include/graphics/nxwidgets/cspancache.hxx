@@ -0,0 +1,248 @@
+/****************************************************************************
+ * apps/include/graphics/nxwidgets/cspancache.hxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CSPANCACHE_HXX
+#define __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CSPANCACHE_HXX
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <semaphore.h>
+
+#include <nuttx/nx/nxglib.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Implementation Classes
+ ****************************************************************************/
+
+#if defined(__cplusplus)
+
+namespace NXWidgets
+{
+  struct SBitmap;
+
+  /**
+   * Describes one opaque region of a bitmap in bitmap coordinates.  Without
+   * row merging, every span is one row high.
+   */
+
+  struct SOpaqueSpan
+  {
+    nxgl_coord_t x;      /**< Left column of the span */
+    nxgl_coord_t y;      /**< Top row of the span */
+    nxgl_coord_t width;  /**< Width of the span in pixels */
+    nxgl_coord_t height; /**< Height of the span in rows */
+  };
+
+  /**
+   * CSpanCache holds the opaque span tables of recently drawn bitmaps so
+   * that drawing a bitmap with a transparent color does not need to
+   * examine every pixel on every draw.  Tables are keyed by the bitmap
+   * memory, its geometry, and the transparent color.  When the cache is
+   * full, the least recently used table is discarded.
+   *
+   * Because tables are keyed by the bitmap memory, only constant bitmaps
+   * (such as glyph images) may be cached.  CGraphicsPort uses the cache
+   * only when the caller of drawBitmap() says that the bitmap is constant.
+   * Code that frees such a bitmap while the cache may still hold it (for
+   * example, when a CGlyphButton is destroyed) must remove it from the
+   * cache with invalidate().
+   *
+   * The cache is shared by all CGraphicsPort instances.  Callers must hold
+   * the cache lock from the call to getSpans() until they are finished with
+   * the returned span table.
+   */
+
+  class CSpanCache
+  {
+  private:
+    /**
+     * One cached span table.  Entries are kept in a doubly linked LRU list
+     * (most recently used at the head).
+     */
+
+    struct SSpanEntry
+    {
+      FAR struct SSpanEntry  *flink;       /**< Next (less recently used) entry */
+      FAR struct SSpanEntry  *blink;       /**< Previous (more recently used) entry */
+      FAR const void         *data;        /**< Bitmap memory (the key) */
+      FAR struct SOpaqueSpan *spans;       /**< The opaque span table */
+      unsigned int            nSpans;      /**< Number of spans in the table */
+      nxgl_coord_t            width;       /**< Bitmap width in pixels */
+      nxgl_coord_t            height;      /**< Bitmap height in rows */
+      uint16_t                stride;      /**< Bitmap width in bytes */
+      nxgl_mxpixel_t          transparent; /**< The transparent color */
+    };
+
+    FAR struct SSpanEntry *m_entries;  /**< Pool of cache entries */
+    FAR struct SSpanEntry *m_head;     /**< Most recently used entry */
+    FAR struct SSpanEntry *m_tail;     /**< Least recently used entry */
+    uint16_t               m_nEntries; /**< Number of entries in the pool */
+    bool                   m_merge;    /**< Merge identical runs on adjacent rows */
+    uint32_t               m_hits;     /**< Number of cache hits */
+    uint32_t               m_misses;   /**< Number of cache misses */
+    sem_t                  m_sem;      /**< Protects the cache */
+
+    /**
+     * Move an entry to the head of the LRU list.
+     */
+
+    void touchEntry(FAR struct SSpanEntry *entry);
+
+    /**
+     * Release the span table of an entry.
+     */
+
+    void freeEntry(FAR struct SSpanEntry *entry);
+
+    /**
+     * Build the opaque span table of a bitmap into an entry.
+     *
+     * @param entry The entry to receive the table.
+     * @param bitmap The bitmap to scan.
+     * @param transparentColor The transparent color used in the bitmap.
+     * @return True on success; false if memory could not be allocated.
+     */
+
+    bool buildSpans(FAR struct SSpanEntry *entry,
+                    FAR const struct SBitmap *bitmap,
+                    nxgl_mxpixel_t transparentColor);
+
+    /**
+     * Copy constructor is protected to prevent usage.
+     */
+
+    inline CSpanCache(const CSpanCache &cache) { }
+
+  public:
+
+    /**
+     * Constructor.
+     *
+     * @param nEntries The maximum number of span tables that will be cached.
+     * @param merge True if identical runs on adjacent rows should be
+     *   merged into rectangles.
+     */
+
+    CSpanCache(uint16_t nEntries, bool merge);
+
+    /**
+     * Destructor.
+     */
+
+    ~CSpanCache(void);
+
+    /**
+     * Get exclusive access to the cache.
+     */
+
+    void lock(void);
+
+    /**
+     * Relinquish exclusive access to the cache.
+     */
+
+    inline void unlock(void)
+    {
+      sem_post(&m_sem);
+    }
+
+    /**
+     * Return the opaque span table of a bitmap, building it if necessary.
+     * The caller must hold the cache lock.  The table remains valid only
+     * until the lock is released.
+     *
+     * @param bitmap The bitmap.
+     * @param transparentColor The transparent color used in the bitmap.
+     * @param spans The location to return the span table.
+     * @param nSpans The location to return the number of spans.
+     * @return True if the table is available; false if it could not be
+     *   built.
+     */
+
+    bool getSpans(FAR const struct SBitmap *bitmap,
+                  nxgl_mxpixel_t transparentColor,
+                  FAR const struct SOpaqueSpan **spans,
+                  FAR unsigned int *nSpans);
+
+    /**
+     * Discard any span tables built for a bitmap.  This must be called
+     * before the bitmap memory is modified or freed.  The caller must hold
+     * the cache lock.
+     *
+     * @param bitmap The bitmap whose span tables are discarded.
+     */
+
+    void invalidate(FAR const struct SBitmap *bitmap);
+
+    /**
+     * Discard all cached span tables.  The statistics are not affected.
+     */
+
+    void flush(void);
+
+    /**
+     * Get the number of look-ups that were satisfied by the cache.
+     *
+     * @return The number of cache hits.
+     */
+
+    inline uint32_t getHits(void) const
+    {
+      return m_hits;
+    }
+
+    /**
+     * Get the number of look-ups that required a span table to be built.
+     *
+     * @return The number of cache misses.
+     */
+
+    inline uint32_t getMisses(void) const
+    {
+      return m_misses;
+    }
+
+    /**
+     * Reset the hit and miss counters.
+     */
+
+    inline void resetStatistics(void)
+    {
+      m_hits   = 0;
+      m_misses = 0;
+    }
+  };
+}
+
+#endif // __cplusplus
+
+#endif // __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CSPANCACHE_HXX
@@ -96,31 +96,94 @@ namespace NXWidgets
   {
   private:
 
-    /**
-     * Struct defining the position and length of a longest line within
-     * the m_linePositions array.
-     */
-
-    typedef struct
-    {
-      int     index;
-      uint8_t width;
-    } LongestLine;
-
     CNxFont              *m_font;            /**< Font to be used for output */
     TNxArray<int>         m_linePositions;   /**< Array containing start indexes
+                                                  of each wrapped line, offset
+                                                  by m_charBase */
+    TNxArray<nxgl_coord_t> m_lineWidths;     /**< Array containing the width
                                                   of each wrapped line */
-    TNxArray<LongestLine> m_longestLines;    /**< Array containing data describing
-                                                  successively longer wrapped
+    TNxArray<int>         m_longestLines;    /**< Array containing the lines
+                                                  that are wider than every
+                                                  line that follows them */
+    int                   m_firstLine;       /**< Number of entries at the
+                                                  front of m_linePositions
+                                                  and m_lineWidths that
+                                                  describe stripped lines */
+    int                   m_firstLongest;    /**< Number of entries at the
+                                                  front of m_longestLines
+                                                  that describe stripped
                                                   lines */
+    int                   m_charBase;        /**< Number of characters
+                                                  stripped from the front of
+                                                  the text since the line
+                                                  positions were recorded */
+    bool                  m_longestStale;    /**< True if m_longestLines may
+                                                  be missing lines */
     nxgl_coord_t          m_lineSpacing;     /**< Spacing between lines of text */
     int32_t               m_textPixelHeight; /**< Total height of the wrapped
                                                   text in pixels */
-    uint8_t               m_textPixelWidth;  /**< Total width of the wrapped text
+    nxgl_coord_t          m_textPixelWidth;  /**< Total width of the wrapped text
                                                   in pixels */
     nxgl_coord_t          m_width;           /**< Width in pixels available t
                                                   the text */
 
+    /**
+     * Get the number of recorded line positions, including the end of
+     * text marker.
+     *
+     * @return The number of line positions.
+     */
+
+    inline int getLinePositionCount(void) const
+    {
+      return m_linePositions.size() - m_firstLine;
+    }
+
+    /**
+     * Record the start of a new line.
+     *
+     * @param pos The char index of the start of the line.
+     * @param width The width of the preceding line in pixels.
+     */
+
+    void pushLine(int pos, nxgl_coord_t width);
+
+    /**
+     * Add a line to the end of the longest line data.
+     *
+     * @param line The index of the line in m_lineWidths.
+     */
+
+    void addLongestLine(int line);
+
+    /**
+     * Discard the wrapping data for the specified line and all lines after
+     * it.
+     *
+     * @param line The first line to discard.
+     */
+
+    void truncateLines(int line);
+
+    /**
+     * Rebuild the longest line data from the recorded line widths.
+     */
+
+    void rebuildLongestLines(void);
+
+    /**
+     * Update the text pixel width and height from the wrapping data.
+     */
+
+    void updatePixelSize(void);
+
+    /**
+     * Release the array entries that describe stripped lines once they
+     * make up most of the arrays.
+     */
+
+    void compactLines(void);
+
   public:
 
     /**
@@ -277,7 +340,7 @@ namespace NXWidgets
      * @return The width of the longest line.
      */
 
-    inline const uint8_t getPixelWidth(void) const
+    inline const nxgl_coord_t getPixelWidth(void) const
     {
       return m_textPixelWidth;
     }
@@ -313,7 +376,7 @@ namespace NXWidgets
 
     inline const int getLineCount(void) const
     {
-      return m_linePositions.size() - 1;
+      return getLinePositionCount() - 1;
     }
 
     /**
@@ -325,7 +388,9 @@ namespace NXWidgets
     CNxFont *getFont(void) const;
 
     /**
-     * Removes lines of text from the start of the text buffer.
+     * Removes lines of text from the start of the text buffer.  The
+     * remaining text is not re-wrapped, so the cost does not depend on
+     * the amount of text that remains.
      *
      * @param lines Number of lines to remove
      */
@@ -368,7 +433,7 @@ namespace NXWidgets
 
     const int getLineStartIndex(const int line) const
     {
-      return m_linePositions[line];
+      return m_linePositions[m_firstLine + line] - m_charBase;
     }
   };
 }
@@ -0,0 +1,171 @@
+/****************************************************************************
+ * apps/include/graphics/nxwidgets/ctimerqueue.hxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CTIMERQUEUE_HXX
+#define __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CTIMERQUEUE_HXX
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <sys/types.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include <semaphore.h>
+
+#include <nuttx/wqueue.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+#include "graphics/nxwidgets/tnxarray.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Implementation Classes
+ ****************************************************************************/
+
+#if defined(__cplusplus)
+
+namespace NXWidgets
+{
+  class CNxTimer;
+
+  /**
+   * CTimerQueue runs all of the CNxTimer instances of one window from a
+   * single work queue entry.  Running timers are held in order of their
+   * deadlines and the work queue entry is scheduled for the earliest one.
+   * Deadlines are rounded up to a multiple of
+   * CONFIG_NXWIDGETS_TIMERQUEUE_SLACK milliseconds so that timers that
+   * expire at about the same time fire together with one wake-up.
+   *
+   * Timers are started and stopped from the application thread and fire
+   * on the work queue thread.  The queue is protected by a semaphore that
+   * is not held while the timers' action events are raised, so event
+   * handlers may freely start and stop timers.
+   */
+
+  class CTimerQueue
+  {
+  private:
+    struct work_s          m_work;       /**< Work queue entry */
+    TNxArray<CNxTimer*>    m_timers;     /**< Running timers, earliest first */
+    clock_t                m_scheduled;  /**< Deadline the work is queued for */
+    bool                   m_isQueued;   /**< True: The work is queued */
+    sem_t                  m_sem;        /**< Protects the queue */
+
+    /**
+     * Get exclusive access to the queue.
+     */
+
+    void lock(void);
+
+    /**
+     * Relinquish exclusive access to the queue.
+     */
+
+    inline void unlock(void)
+    {
+      sem_post(&m_sem);
+    }
+
+    /**
+     * Add a timer to the queue in order of its deadline.  The caller
+     * must hold the lock.
+     *
+     * @param timer The timer to add.
+     * @param now The current system time in ticks.
+     */
+
+    void insertTimer(CNxTimer *timer, clock_t now);
+
+    /**
+     * Queue the work for the earliest deadline, or cancel it if no timers
+     * are running.  The caller must hold the lock.
+     *
+     * @param now The current system time in ticks.
+     */
+
+    void schedule(clock_t now);
+
+    /**
+     * Static function called from the work queue when the earliest
+     * deadline expires.
+     *
+     * @param arg Pointer to the CTimerQueue instance.
+     */
+
+    static void workQueueCallback(FAR void *arg);
+
+    /**
+     * Copy constructor is protected to prevent usage.
+     */
+
+    inline CTimerQueue(const CTimerQueue &queue) { }
+
+  public:
+
+    /**
+     * Constructor.
+     */
+
+    CTimerQueue(void);
+
+    /**
+     * Destructor.  Cancels the work queue entry.
+     */
+
+    ~CTimerQueue(void);
+
+    /**
+     * Start a timer.  The timer fires after its timeout.
+     *
+     * @param timer The timer to start.
+     */
+
+    void startTimer(CNxTimer *timer);
+
+    /**
+     * Stop a timer.  Does nothing if the timer is not running.
+     *
+     * @param timer The timer to stop.
+     */
+
+    void stopTimer(CNxTimer *timer);
+
+    /**
+     * Get the number of running timers.
+     *
+     * @return The number of running timers.
+     */
+
+    inline int getActiveTimerCount(void) const
+    {
+      return m_timers.size();
+    }
+  };
+}
+
+#endif // __cplusplus
+
+#endif // __APPS_INCLUDE_GRAPHICS_NXWIDGETS_CTIMERQUEUE_HXX
@@ -33,10 +33,14 @@
 #include <semaphore.h>
 #include <time.h>
 
+#include <nuttx/wqueue.h>
+
 #include "graphics/nxwidgets/nxconfig.hxx"
 #include "graphics/nxwidgets/cgraphicsport.hxx"
 #include "graphics/nxwidgets/cnxwidget.hxx"
 #include "graphics/nxwidgets/crect.hxx"
+#include "graphics/nxwidgets/crectlist.hxx"
+#include "graphics/nxwidgets/ctimerqueue.hxx"
 #include "graphics/nxwidgets/cwidgetstyle.hxx"
 #include "graphics/nxwidgets/cwindoweventhandler.hxx"
 #include "graphics/nxwidgets/cwindoweventhandlerlist.hxx"
@@ -52,6 +56,7 @@ namespace NXWidgets
 {
   class INxWindow;
   class CNxWidget;
+  class CBufferedWindow;
 
   /**
    * Class providing a top-level widget and an interface to the CWidgetControl
@@ -143,6 +148,22 @@ namespace NXWidgets
       struct timespec leftReleaseTime;       /**< Time the left button was
                                                   released */
     };
+
+#ifdef CONFIG_NXWIDGETS_XYQUEUE
+    /**
+     * One queued mouse or touchscreen sample.  A sample is an edge if its
+     * buttons differ from those of the sample queued before it.  Edges
+     * are never coalesced.
+     */
+
+    struct SXYSample
+    {
+      nxgl_coord_t    x;                     /**< X coordinate of the sample */
+      nxgl_coord_t    y;                     /**< Y coordinate of the sample */
+      uint8_t         buttons;               /**< See NX_MOUSE_* definitions */
+      bool            edge;                  /**< True: Button state changed */
+    };
+#endif
 #endif
 
     /**
@@ -164,6 +185,22 @@ namespace NXWidgets
     sem_t                       m_waitSem;        /**< External loops waits for
                                                        events on this semaphore */
 #endif
+#ifdef CONFIG_NXWIDGETS_DAMAGE
+    CRectList                   m_damage;         /**< Damaged regions awaiting
+                                                       redraw */
+#endif
+#ifdef CONFIG_NXWIDGETS_TIMERQUEUE
+    CTimerQueue                 m_timerQueue;     /**< Runs the window's
+                                                       timers */
+#endif
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+    INxWindow                  *m_window;         /**< The window that the port
+                                                       was created for */
+    CBufferedWindow            *m_backBuffer;     /**< Off-screen back buffer
+                                                       (if double buffered) */
+    bool                        m_doubleBuffered; /**< True: Draw into a back
+                                                       buffer */
+#endif
 
     /**
      * I/O
@@ -172,6 +209,29 @@ namespace NXWidgets
 #ifdef CONFIG_NX_XYINPUT
     struct SXYInput             m_xyinput;        /**< Current XY input
                                                        device state */
+#endif
+#ifdef CONFIG_NXWIDGETS_XYQUEUE
+    struct SXYSample            m_xyqueue[CONFIG_NXWIDGETS_XYQUEUE_SIZE];
+    uint8_t                     m_xyhead;         /**< Index of the oldest
+                                                       queued sample */
+    uint8_t                     m_xycount;        /**< Number of queued
+                                                       samples */
+    uint8_t                     m_xybuttons;      /**< Buttons of the most
+                                                       recently queued sample */
+    struct timespec             m_xyDragTime;     /**< Time of the last
+                                                       dispatched drag */
+    uint32_t                    m_xyMerged;       /**< Number of samples
+                                                       coalesced */
+    uint32_t                    m_xyDropped;      /**< Number of samples lost
+                                                       to a full queue */
+#ifdef NXWIDGETS_XYQUEUE_REPOLL
+    struct work_s               m_xyWork;         /**< Re-polls a held move */
+    uint8_t                     m_xyWorkPending;  /**< Re-polls queued or
+                                                       running */
+    bool                        m_xyWorkWaiting;  /**< The destructor waits
+                                                       for a re-poll */
+    sem_t                       m_xyWorkSem;      /**< Wakes the destructor */
+#endif
 #endif
     CNxWidget                  *m_clickedWidget;  /**< Pointer to the widget
                                                        that is clicked. */
@@ -260,6 +320,56 @@ namespace NXWidgets
 
     bool pollMouseEvents(CNxWidget* widget);
 
+#ifdef CONFIG_NX_XYINPUT
+    /**
+     * Update the mouse/touchscreen state with a new sample, detecting
+     * button press, drag and release events.
+     *
+     * @param x The X coordinate of the sample.
+     * @param y The Y coordinate of the sample.
+     * @param buttons See NX_MOUSE_* definitions.
+     */
+
+    void updateMouseState(nxgl_coord_t x, nxgl_coord_t y, uint8_t buttons);
+
+    /**
+     * Send the events detected by the last call to updateMouseState()
+     * throughout the hierarchy.
+     *
+     * @param widget.  Specific widget to poll.  Use NULL to run the
+     *    all widgets in the window.
+     * @return True means an interesting mouse event occurred
+     */
+
+    bool dispatchMouseEvents(CNxWidget* widget);
+#endif
+
+#ifdef CONFIG_NXWIDGETS_XYQUEUE
+    /**
+     * Add a sample to the mouse/touchscreen queue.  A sample with the
+     * same buttons as the sample before it replaces the position of the
+     * last queued sample if that sample is not an edge.
+     *
+     * @param pos The (x,y) position of the mouse.
+     * @param buttons See NX_MOUSE_* definitions.
+     */
+
+    void queueMouseEvent(FAR const struct nxgl_point_s *pos, uint8_t buttons);
+
+#ifdef NXWIDGETS_XYQUEUE_REPOLL
+    /**
+     * Work queue callback that runs when the minimum drag period of a held
+     * move has passed.  It only wakes the thread waiting in
+     * waitForWindowEvent(); the held move is then dispatched by the next
+     * call to pollEvents() on that thread.
+     *
+     * @param arg The CWidgetControl instance.
+     */
+
+    static void xyWorkCallback(FAR void *arg);
+#endif
+#endif
+
     /**
      * Process keypad events and send throughout the hierarchy.
      *
@@ -276,6 +386,28 @@ namespace NXWidgets
 
     bool pollCursorControlEvents(void);
 
+    /**
+     * Redraw the top-level widgets that intersect a region of the window,
+     * with drawing clipped to that region.
+     *
+     * @param rect The window-relative region to redraw.
+     */
+
+    void redrawRegion(const CRect &rect);
+
+#ifdef CONFIG_NXWIDGETS_DAMAGE
+    /**
+     * Redraw the parts of the window that have been invalidated since the
+     * last call.  Each damaged region is redrawn separately with drawing
+     * clipped to the region, and only the widgets that intersect the
+     * region are redrawn.
+     *
+     * @return True means that some part of the window was redrawn
+     */
+
+    bool processDamage(void);
+#endif
+
 #ifdef CONFIG_NXWIDGET_EVENTWAIT
     /**
      * Wake up and external logic that is waiting for a window event.
@@ -414,6 +546,7 @@ namespace NXWidgets
      *   pollMouseEvents(widget)
      *   pollKeyboardEvents()
      *   pollCursorControlEvents()
+     *   processDamage() (if CONFIG_NXWIDGETS_DAMAGE is defined)
      *
      * @param widget.  Specific widget to poll.  Use NULL to run through
      *    of the widgets in the window.
@@ -462,6 +595,24 @@ namespace NXWidgets
       return m_widgets.size();
     }
 
+    /**
+     * Get a controlled widget.  Widgets are held in the order that they
+     * were added.
+     *
+     * @param index The index of the widget.
+     * @return The widget, or NULL if the index is out of range.
+     */
+
+    inline CNxWidget *getControlledWidget(const int index) const
+    {
+      if (index < 0 || index >= m_widgets.size())
+        {
+          return (CNxWidget *)0;
+        }
+
+      return m_widgets[index];
+    }
+
     /**
      * Add a widget to the list of widgets to be deleted.
      * Must never be called by anything other than the framework itself.
@@ -471,6 +622,33 @@ namespace NXWidgets
 
     void addToDeleteQueue(CNxWidget *widget);
 
+    /**
+     * Mark a region of the window as needing to be redrawn.  With
+     * CONFIG_NXWIDGETS_DAMAGE, the region is added to the damaged regions
+     * (coalescing it with any that it overlaps or touches) and is redrawn
+     * on the next call to pollEvents().  Otherwise, the widgets that
+     * intersect the region are redrawn immediately.
+     *
+     * @param rect The window-relative region to be redrawn.
+     */
+
+    void invalidate(const CRect &rect);
+
+    /**
+     * Check if any part of the window is waiting to be redrawn.
+     *
+     * @return True if there are damaged regions.
+     */
+
+    inline bool hasDamage(void) const
+    {
+#ifdef CONFIG_NXWIDGETS_DAMAGE
+      return !m_damage.isEmpty();
+#else
+      return false;
+#endif
+    }
+
     /**
      * Set the clicked widget pointer.  Note that this should not be
      * called by code other than within the CWidgetControl library itself.
@@ -539,6 +717,73 @@ namespace NXWidgets
 #endif
     }
 
+#ifdef CONFIG_NXWIDGETS_TIMERQUEUE
+    /**
+     * Get the queue that runs the CNxTimer instances of this window.
+     *
+     * @return The window's timer queue.
+     */
+
+    inline CTimerQueue *getTimerQueue(void)
+    {
+      return &m_timerQueue;
+    }
+
+    /**
+     * Get the number of CNxTimer instances of this window that are
+     * running.
+     *
+     * @return The number of running timers.
+     */
+
+    inline int getActiveTimerCount(void) const
+    {
+      return m_timerQueue.getActiveTimerCount();
+    }
+#endif
+
+#ifdef CONFIG_NXWIDGETS_XYQUEUE
+    /**
+     * Check if mouse/touchscreen samples are waiting to be processed.  A
+     * move held back by CONFIG_NXWIDGETS_XYQUEUE_MINPERIOD remains queued
+     * until the period has passed.  With CONFIG_NXWIDGET_EVENTWAIT, the
+     * thread in waitForWindowEvent() is then woken so that the move is
+     * dispatched by its next call to pollEvents().  Otherwise the move is
+     * dispatched by the first poll after the period has passed.
+     *
+     * @return True if samples are queued.
+     */
+
+    inline bool hasMouseEvents(void) const
+    {
+      return m_xycount > 0;
+    }
+
+    /**
+     * Get the number of mouse/touchscreen samples that have been
+     * coalesced into a later sample.
+     *
+     * @return The number of merged samples.
+     */
+
+    inline uint32_t getMergedMouseEvents(void) const
+    {
+      return m_xyMerged;
+    }
+
+    /**
+     * Get the number of mouse/touchscreen samples that have been
+     * discarded because the queue was full.
+     *
+     * @return The number of dropped samples.
+     */
+
+    inline uint32_t getDroppedMouseEvents(void) const
+    {
+      return m_xyDropped;
+    }
+#endif
+
     /**
      * Get the default widget style for this window.
      *
@@ -778,6 +1023,43 @@ namespace NXWidgets
      return m_port;
    }
 
+#ifdef CONFIG_NXWIDGETS_DOUBLEBUFFER
+   /**
+    * Select whether this window draws into an off-screen back buffer.
+    * When double buffered, all drawing goes to a memory bitmap the size of
+    * the window and the modified regions are sent to the window, one
+    * bitmap operation per region, at the end of each pollEvents() (or by
+    * flushBackBuffer()).  This may be called before or after the window
+    * is created.  The CGraphicsPort returned by getGraphicsPort() is kept;
+    * only the window that it draws to changes.
+    *
+    * @param enable True: draw into a back buffer; False: draw directly in
+    *   the window.
+    * @return True on success.
+    */
+
+   bool setDoubleBuffered(bool enable);
+
+   /**
+    * Check if the window is double buffered.
+    *
+    * @return True if drawing goes to a back buffer.
+    */
+
+   inline bool isDoubleBuffered(void) const
+   {
+     return m_backBuffer != NULL;
+   }
+
+   /**
+    * Send everything drawn in the back buffer since the last flush to the
+    * window.  This is done automatically at the end of pollEvents() and
+    * only needs to be called by logic that draws outside of the event loop.
+    */
+
+   void flushBackBuffer(void);
+#endif
+
    /**
     * Adds a window event handler.  The window handler will receive
     * notification all NX events received by this window\.
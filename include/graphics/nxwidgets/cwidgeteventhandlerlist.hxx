@@ -70,6 +70,7 @@
 
 #include "graphics/nxwidgets/cwidgeteventhandler.hxx"
 #include "graphics/nxwidgets/tnxarray.hxx"
+#include "graphics/nxwidgets/tnxsmallarray.hxx"
 
 /****************************************************************************
  * Pre-Processor Definitions
@@ -92,7 +93,12 @@ namespace NXWidgets
   class CWidgetEventHandlerList
   {
   protected:
+#ifdef CONFIG_NXWIDGETS_HANDLERINLINE
+    TNxSmallArray<CWidgetEventHandler*, CONFIG_NXWIDGETS_HANDLERINLINE_SIZE>
+      m_widgetEventHandlers; /**< List of event handlers */
+#else
     TNxArray<CWidgetEventHandler*> m_widgetEventHandlers; /**< List of event handlers */
+#endif
     CNxWidget *m_widget;                                  /**< Owning widget */
     bool m_isEnabled;                                     /**< Indicates if events are active */
 
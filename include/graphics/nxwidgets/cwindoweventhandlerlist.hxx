@@ -34,6 +34,7 @@
 
 #include "graphics/nxwidgets/cwindoweventhandler.hxx"
 #include "graphics/nxwidgets/tnxarray.hxx"
+#include "graphics/nxwidgets/tnxsmallarray.hxx"
 
 /****************************************************************************
  * Pre-Processor Definitions
@@ -55,7 +56,12 @@ namespace NXWidgets
   class CWindowEventHandlerList
   {
   protected:
+#ifdef CONFIG_NXWIDGETS_HANDLERINLINE
+    TNxSmallArray<CWindowEventHandler*, CONFIG_NXWIDGETS_HANDLERINLINE_SIZE>
+      m_eventHandlers; /**< List of event handlers */
+#else
     TNxArray<CWindowEventHandler*> m_eventHandlers; /**< List of event handlers */
+#endif
 
     /**
      * Return the index to the window event handler.
@@ -188,6 +188,14 @@ namespace NXWidgets
 
     virtual const int getSelectedIndex(void) const = 0;
 
+    /**
+     * Get the number of selected options.
+     *
+     * @return The number of selected options.
+     */
+
+    virtual const int getSelectedCount(void) const = 0;
+
     /**
      * Sets the selected index.  Specify -1 to select nothing.  Resets any
      * other selected options to deselected.
@@ -71,6 +71,54 @@
  *   The smallest BPP configuration supported by NX.
  * CONFIG_NXWIDGETS_SIZEOFCHAR - Size of character {1 or 2 bytes}.  Default
  *   Determined by CONFIG_NXWIDGETS_SIZEOFCHAR
+ * CONFIG_NXWIDGETS_TEXTRUN - Compose each string off-screen and send it to
+ *   the window with a single bitmap operation.  Default: Not defined
+ * CONFIG_NXWIDGETS_GLYPHCACHE - Cache pre-rendered font glyphs so that
+ *   repeatedly drawn text only costs a blit.  Default: Not defined
+ * CONFIG_NXWIDGETS_GLYPHCACHE_SIZE - The maximum number of glyphs held in
+ *   the glyph cache.  Default: 64
+ * CONFIG_NXWIDGETS_SPANCACHE - Cache the opaque spans of constant bitmaps drawn
+ *   with a transparent color.  Default: Not defined
+ * CONFIG_NXWIDGETS_SPANCACHE_SIZE - The maximum number of bitmaps held in
+ *   the span cache.  Default: 16
+ * CONFIG_NXWIDGETS_SPANCACHE_MERGE - Merge identical spans on adjacent rows
+ *   into rectangles.  Default: Not defined
+ * CONFIG_NXWIDGETS_DAMAGE - Accumulate invalidated regions and redraw only
+ *   the damaged parts of the window on the next event poll.  Default: Not
+ *   defined
+ * CONFIG_NXWIDGETS_DAMAGE_NRECTS - The maximum number of separate damaged
+ *   regions held per window.  Default: 8
+ * CONFIG_NXWIDGETS_DOUBLEBUFFER - Support windows that draw into an
+ *   off-screen back buffer.  Default: Not defined
+ * CONFIG_NXWIDGETS_DOUBLEBUFFER_NRECTS - The maximum number of separate
+ *   modified regions tracked per back buffer.  Default: 8
+ * CONFIG_NXWIDGETS_RLEINDEX - Index the row start positions of RLE
+ *   bitmaps so that rows can be decoded out of order.  Default: Not defined
+ * CONFIG_NXWIDGETS_RLEINDEX_INTERVAL - The number of rows between RLE row
+ *   index entries.  Default: 8
+ * CONFIG_NXWIDGETS_RLEEXPANDED - Copy runs of RLE images from an expanded
+ *   copy of the image.  The copies generated by "mksrle.sh -x" are used if
+ *   present.  Otherwise the image is expanded into RAM when first drawn.
+ *   Default: Not defined
+ * CONFIG_NXWIDGETS_SCALEDCACHE - Keep the complete scaled image of each
+ *   CScaledBitmap after it is first drawn.  Default: Not defined
+ * CONFIG_NXWIDGETS_FONTWIDTHS - Keep a table of the widths of the 8-bit
+ *   characters in each CNxFont.  Default: Not defined
+ * CONFIG_NXWIDGETS_STRINGINLINE - Hold short strings within the CNxString
+ *   object instead of on the heap.  Default: Not defined
+ * CONFIG_NXWIDGETS_STRINGINLINE_SIZE - The number of characters held within
+ *   each CNxString.  Default: 16
+ * CONFIG_NXWIDGETS_HANDLERINLINE - Hold the first event handlers of each
+ *   handler list within the list instead of on the heap.  Default: Not
+ *   defined
+ * CONFIG_NXWIDGETS_HANDLERINLINE_SIZE - The number of event handlers held
+ *   within each handler list.  Default: 2
+ * CONFIG_NXWIDGETS_IMAGECACHE - Keep the converted contents of each CImage
+ *   so that unchanged images are redrawn with one bitmap operation.
+ *   Default: Not defined
+ * CONFIG_NXWIDGETS_PIXELBUFFER - Keep the working buffer of the
+ *   CGraphicsPort greyscale and invert operations between calls.  Default:
+ *   Not defined
  *
  * NXWidget Default Values
  *
@@ -112,6 +160,16 @@
  * CONFIG_NXWIDGETS_CURSORCONTROL_SIZE - Size of incoming cursor control
  *   buffer, i.e., the maximum number of cursor controls that can between
  *   entered by NX polling cycles without losing data.  Default: 4
+ * CONFIG_NXWIDGETS_TIMERQUEUE - Run all of the timers of a window from one
+ *   work queue entry.  Default: Not defined
+ * CONFIG_NXWIDGETS_TIMERQUEUE_SLACK - Timer deadlines are rounded up to a
+ *   multiple of this many milliseconds.  Default: 10
+ * CONFIG_NXWIDGETS_XYQUEUE - Queue mouse/touchscreen samples between polling
+ *   cycles, coalescing consecutive moves.  Default: Not defined
+ * CONFIG_NXWIDGETS_XYQUEUE_SIZE - The maximum number of queued samples.
+ *   Default: 8
+ * CONFIG_NXWIDGETS_XYQUEUE_MINPERIOD - The minimum time between two drag
+ *   events (in milliseconds).  Zero disables rate limiting.  Default: 0
  */
 
 /* Prerequisites ************************************************************/
@@ -283,6 +341,48 @@
 #  error "Unsupported character width (CONFIG_NXWIDGETS_SIZEOFCHAR)"
 #endif
 
+/* Glyph cache */
+
+#if defined(CONFIG_NXWIDGETS_GLYPHCACHE) && !defined(CONFIG_NXWIDGETS_GLYPHCACHE_SIZE)
+#  define CONFIG_NXWIDGETS_GLYPHCACHE_SIZE 64
+#endif
+
+/* Opaque span cache */
+
+#if defined(CONFIG_NXWIDGETS_SPANCACHE) && !defined(CONFIG_NXWIDGETS_SPANCACHE_SIZE)
+#  define CONFIG_NXWIDGETS_SPANCACHE_SIZE 16
+#endif
+
+/* Damage-region redraw */
+
+#if defined(CONFIG_NXWIDGETS_DAMAGE) && !defined(CONFIG_NXWIDGETS_DAMAGE_NRECTS)
+#  define CONFIG_NXWIDGETS_DAMAGE_NRECTS 8
+#endif
+
+/* Double-buffered windows */
+
+#ifndef CONFIG_NXWIDGETS_DOUBLEBUFFER_NRECTS
+#  define CONFIG_NXWIDGETS_DOUBLEBUFFER_NRECTS 8
+#endif
+
+/* RLE bitmap row index */
+
+#if defined(CONFIG_NXWIDGETS_RLEINDEX) && !defined(CONFIG_NXWIDGETS_RLEINDEX_INTERVAL)
+#  define CONFIG_NXWIDGETS_RLEINDEX_INTERVAL 8
+#endif
+
+/* Inline string storage */
+
+#if defined(CONFIG_NXWIDGETS_STRINGINLINE) && !defined(CONFIG_NXWIDGETS_STRINGINLINE_SIZE)
+#  define CONFIG_NXWIDGETS_STRINGINLINE_SIZE 16
+#endif
+
+/* Inline event handler storage */
+
+#if defined(CONFIG_NXWIDGETS_HANDLERINLINE) && !defined(CONFIG_NXWIDGETS_HANDLERINLINE_SIZE)
+#  define CONFIG_NXWIDGETS_HANDLERINLINE_SIZE 2
+#endif
+
 /* NXWidget Default Values **************************************************/
 /**
  * Default font ID
@@ -417,6 +517,44 @@
 #  define CONFIG_NXWIDGETS_CURSORCONTROL_SIZE 4
 #endif
 
+/**
+ * Shared timer queue
+ */
+
+#if defined(CONFIG_NXWIDGETS_TIMERQUEUE) && !defined(CONFIG_NXWIDGETS_TIMERQUEUE_SLACK)
+#  define CONFIG_NXWIDGETS_TIMERQUEUE_SLACK 10
+#endif
+
+/**
+ * Mouse/touchscreen event queue
+ */
+
+#ifndef CONFIG_NX_XYINPUT
+#  undef CONFIG_NXWIDGETS_XYQUEUE
+#endif
+
+#ifdef CONFIG_NXWIDGETS_XYQUEUE
+#  ifndef CONFIG_NXWIDGETS_XYQUEUE_SIZE
+#    define CONFIG_NXWIDGETS_XYQUEUE_SIZE 8
+#  endif
+
+#  if CONFIG_NXWIDGETS_XYQUEUE_SIZE < 2 || CONFIG_NXWIDGETS_XYQUEUE_SIZE > 255
+#    error "CONFIG_NXWIDGETS_XYQUEUE_SIZE must be in the range 2-255"
+#  endif
+
+#  ifndef CONFIG_NXWIDGETS_XYQUEUE_MINPERIOD
+#    define CONFIG_NXWIDGETS_XYQUEUE_MINPERIOD 0
+#  endif
+
+/* A held move is re-polled by waking the thread waiting in
+ * CWidgetControl::waitForWindowEvent(), so there must be one.
+ */
+
+#  if CONFIG_NXWIDGETS_XYQUEUE_MINPERIOD > 0 && defined(CONFIG_NXWIDGET_EVENTWAIT)
+#    define NXWIDGETS_XYQUEUE_REPOLL 1
+#  endif
+#endif
+
 /****************************************************************************
  * Public Types
  ****************************************************************************/
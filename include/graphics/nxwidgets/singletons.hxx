@@ -86,6 +86,8 @@ namespace NXWidgets
 
   class CWidgetStyle;
   class CNxString;
+  class CGlyphCache;
+  class CSpanCache;
 
   /**
    * Global singleton instances
@@ -94,6 +96,12 @@ namespace NXWidgets
   extern CWidgetStyle        *g_defaultWidgetStyle; /**< The default widget style */
   extern CNxString           *g_nullString;         /**< The reusable empty string */
   extern TNxArray<CNxTimer*> *g_nxTimers;           /**< An array of all timers */
+#ifdef CONFIG_NXWIDGETS_GLYPHCACHE
+  extern CGlyphCache         *g_glyphCache;         /**< The shared glyph cache */
+#endif
+#ifdef CONFIG_NXWIDGETS_SPANCACHE
+  extern CSpanCache          *g_spanCache;          /**< The shared span cache */
+#endif
 
   /**
    * Setup misc singleton instances.
@@ -0,0 +1,299 @@
+/****************************************************************************
+ * apps/include/graphics/nxwidgets/tnxsmallarray.hxx
+ *
+ * Licensed to the Apache Software Foundation (ASF) under one or more
+ * contributor license agreements.  See the NOTICE file distributed with
+ * this work for additional information regarding copyright ownership.  The
+ * ASF licenses this file to you under the Apache License, Version 2.0 (the
+ * "License"); you may not use this file except in compliance with the
+ * License.  You may obtain a copy of the License at
+ *
+ *   http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.  See the
+ * License for the specific language governing permissions and limitations
+ * under the License.
+ *
+ ****************************************************************************/
+
+#ifndef __APPS_INCLUDE_GRAPHICS_NXWIDGETS_TNXSMALLARRAY_HXX
+#define __APPS_INCLUDE_GRAPHICS_NXWIDGETS_TNXSMALLARRAY_HXX
+
+/****************************************************************************
+ * Included Files
+ ****************************************************************************/
+
+#include <nuttx/config.h>
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#include "graphics/nxwidgets/nxconfig.hxx"
+
+/****************************************************************************
+ * Pre-Processor Definitions
+ ****************************************************************************/
+
+/****************************************************************************
+ * Implementation Classes
+ ****************************************************************************/
+
+#if defined(__cplusplus)
+
+/**
+ * Class providing a dynamic array with room for the first N items within
+ * the object itself.  The heap is only used once more than N items have
+ * been added.  It provides the same interface as TNxArray and is intended
+ * for lists that are usually short, such as lists of event handlers.
+ */
+
+template <class T, int N>
+class TNxSmallArray
+{
+private:
+  T  *m_data;          /**< The inline or the heap array of data items */
+  int m_size;          /**< Number of items in the array */
+  int m_reservedSize;  /**< Total size of the array including unpopulated slots */
+  T   m_inline[N];     /**< Inline storage for the first N data items */
+
+  /**
+   * Resize the array if it is full.
+   */
+
+  void resize(void);
+
+  /**
+   * Copy constructor and assignment are not supported.
+   */
+
+  TNxSmallArray(const TNxSmallArray<T, N> &array);
+  TNxSmallArray<T, N> &operator=(const TNxSmallArray<T, N> &array);
+
+public:
+
+  /**
+   * Constructor.  Creates an empty array using the inline storage.
+   */
+
+  inline TNxSmallArray();
+
+  /**
+   * Destructor.
+   */
+
+  inline ~TNxSmallArray();
+
+  /**
+   * Get the size of the array.
+   *
+   * @return The size of the array.
+   */
+
+  inline const int size(void) const;
+
+  /**
+   * Add a value to the end of the array.
+   *
+   * @param value The value to add to the array.
+   */
+
+  void push_back(const T &value);
+
+  /**
+   * Insert a value into the array.
+   *
+   * @param index The index to insert into.
+   * @param value The value to insert.
+   */
+
+  void insert(const int index, const T &value);
+
+  /**
+   * Remove the last element from the array.
+   */
+
+  void pop_back(void);
+
+  /**
+   * Erase a single value at the specified index
+   */
+
+  void erase(const int index);
+
+  /**
+   * Get a value at the specified location.  Does not perform bounds checking.
+   * @param index The index of the desired value.
+   * @return The value at the specified index.
+   */
+
+  inline T &at(const int index) const;
+
+  /**
+   * Check if the array has any data.
+   * @return True if the array is empty.
+   */
+
+  inline bool empty(void) const;
+
+  /**
+   * Remove all data.  Heap storage, if any, is kept for reuse.
+   */
+
+  void clear();
+
+  /**
+   * Overload the [] operator to allow array-style access.
+   * @param index The index to retrieve.
+   * @return The value at the specified index.
+   */
+
+  inline T& operator[](const int index) const;
+};
+
+template <class T, int N>
+TNxSmallArray<T, N>::TNxSmallArray()
+{
+  m_data         = m_inline;  // Start with the inline storage
+  m_size         = 0;         // Number of data items in use
+  m_reservedSize = N;         // Number of data items available
+}
+
+template <class T, int N>
+TNxSmallArray<T, N>::~TNxSmallArray()
+{
+  if (m_data != m_inline)
+    {
+      delete [] m_data;
+    }
+}
+
+template <class T, int N>
+const int TNxSmallArray<T, N>::size(void) const
+{
+  return m_size;
+}
+
+template <class T, int N>
+void TNxSmallArray<T, N>::push_back(const T &value)
+{
+  // Ensure the array is large enough to hold one more data item
+
+  resize();
+
+  // Add data to array
+
+  m_data[m_size] = value;
+  m_size++;
+}
+
+template <class T, int N>
+void TNxSmallArray<T, N>::pop_back(void)
+{
+  if (m_size >= 1)
+    {
+      m_size--;
+    }
+}
+
+template <class T, int N>
+void TNxSmallArray<T, N>::insert(const int index, const T &value)
+{
+  // Bounds check
+
+  if (index >= m_size)
+    {
+      push_back(value);
+      return;
+    }
+
+  // Ensure the array is large enough to hold one more data item
+
+  resize();
+
+  // Shift all of the data back one place to make a space for the new data
+
+  for (int i = m_size; i > index; i--)
+    {
+      m_data[i] = m_data[i - 1];
+    }
+
+  m_data[index] = value;
+  m_size++;
+}
+
+template <class T, int N>
+void TNxSmallArray<T, N>::erase(const int index)
+{
+  // Bounds check
+
+  if (index >= m_size)
+    {
+      return;
+    }
+
+  // Shift all of the data back one place and overwrite the value
+
+  for (int i = index; i < m_size - 1; i++)
+    {
+      m_data[i] = m_data[i + 1];
+    }
+
+  m_size--;
+}
+
+template <class T, int N>
+void TNxSmallArray<T, N>::resize(void)
+{
+  // Is there room for one more entry?
+
+  if (m_reservedSize == m_size)
+    {
+      // No.. move the data to a larger array on the heap
+
+      int newSize = m_reservedSize + CONFIG_NXWIDGETS_TNXARRAY_SIZEINCREMENT;
+      T *newData  = new T[newSize];
+
+      for (int i = 0; i < m_size; i++)
+        {
+          newData[i] = m_data[i];
+        }
+
+      if (m_data != m_inline)
+        {
+          delete [] m_data;
+        }
+
+      m_data         = newData;
+      m_reservedSize = newSize;
+    }
+}
+
+template <class T, int N>
+T& TNxSmallArray<T, N>::at(const int index) const
+{
+  return m_data[index];
+}
+
+template <class T, int N>
+bool TNxSmallArray<T, N>::empty() const
+{
+  return (m_size == 0);
+}
+
+template <class T, int N>
+T& TNxSmallArray<T, N>::operator[](const int index) const
+{
+  return m_data[index];
+}
+
+template <class T, int N>
+void TNxSmallArray<T, N>::clear()
+{
+  m_size = 0;
+}
+
+#endif // __cplusplus
+
+#endif // __APPS_INCLUDE_GRAPHICS_NXWIDGETS_TNXSMALLARRAY_HXX
@@ -67,6 +67,10 @@ namespace NxWM
     CApplicationWindow *m_window;      /**< Reference to the application window */
     NXTERM              m_nxterm;      /**< NxTerm handle */
     pid_t               m_pid;         /**< Task ID of the NxTerm thread */
+#ifdef CONFIG_NXWM_NXTERM_BATCH
+    pid_t               m_relay;       /**< Task ID of the NxTerm output task */
+    FAR char           *m_relayBuffer; /**< Batch buffer of the output task */
+#endif
     int                 m_minor;       /**< Terminal device minor number */
 
     /**
@@ -76,6 +80,17 @@ namespace NxWM
 
     static int nxterm(int argc, char *argv[]);
 
+#ifdef CONFIG_NXWM_NXTERM_BATCH
+    /**
+     * This is the NxTerm output task.  It receives the NSH output through a
+     * pipe, collects the output for up to one batch period and then writes it
+     * to the NxTerm driver in a single write.  Lines that would scroll out of
+     * the window within the same batch are not written at all.
+     */
+
+    static int outputRelay(int argc, char *argv[]);
+#endif
+
     /**
      * This is the NxTerm task exit handler.  It is registered with on_exit()
      * and called automatically when the nxterm task exits.
@@ -50,6 +50,11 @@
  *   NXFONT_DEFAULT
  * CONFIG_NXWM_TOUCHSCREEN - Define to build in touchscreen support.
  * CONFIG_NXWM_KEYBOARD - Define to build in touchscreen support.
+ * CONFIG_NXWM_ICONCACHE - Convert each start window and task bar icon to
+ *   the display format once and draw it from that copy.  Default: Not
+ *   defined
+ * CONFIG_NXWM_STARTUP_TRACE - Print the time taken by each step of the
+ *   NxWM initialization.  Default: Not defined
  */
 
 #ifndef CONFIG_HAVE_CXX
@@ -354,6 +359,15 @@
  *   display.
  * CONFIG_NXWM_NXTERM_STACKSIZE - The stack size to use when starting the
  *   NxTerm task.  Default: 2048 bytes.
+ * CONFIG_NXWM_NXTERM_BATCH - Collect the NSH output in a separate task and
+ *   write it to the NxTerm driver in batches.  Requires that all file
+ *   descriptors are cloned to new tasks.  Default: Not defined
+ * CONFIG_NXWM_NXTERM_BATCH_PERIOD - The longest time that output is held
+ *   before it is written.  Default: 16 msec
+ * CONFIG_NXWM_NXTERM_BATCH_SIZE - The size of the batch buffer.  Default:
+ *   1024 bytes
+ * CONFIG_NXWM_NXTERM_BATCH_STACKSIZE - The stack size of the output task.
+ *   Default: 1024 bytes
  * CONFIG_NXWM_NXTERM_WCOLOR - The color of the NxTerm window background.
  *   Default:  MKRGB(192,192,192)
  * CONFIG_NXWM_NXTERM_FONTCOLOR - The color of the fonts to use in the
@@ -377,6 +391,24 @@
 #    define CONFIG_NXWM_NXTERM_STACKSIZE  2048
 #  endif
 
+#  if defined(CONFIG_FDCLONE_DISABLE) || defined(CONFIG_FDCLONE_STDIO)
+#    undef CONFIG_NXWM_NXTERM_BATCH
+#  endif
+
+#  ifdef CONFIG_NXWM_NXTERM_BATCH
+#    ifndef CONFIG_NXWM_NXTERM_BATCH_PERIOD
+#      define CONFIG_NXWM_NXTERM_BATCH_PERIOD  16
+#    endif
+
+#    ifndef CONFIG_NXWM_NXTERM_BATCH_SIZE
+#      define CONFIG_NXWM_NXTERM_BATCH_SIZE  1024
+#    endif
+
+#    ifndef CONFIG_NXWM_NXTERM_BATCH_STACKSIZE
+#      define CONFIG_NXWM_NXTERM_BATCH_STACKSIZE  1024
+#    endif
+#  endif
+
 #  ifndef CONFIG_NXWM_NXTERM_WCOLOR
 #    define CONFIG_NXWM_NXTERM_WCOLOR  CONFIG_NXWM_DEFAULT_BACKGROUNDCOLOR
 #  endif
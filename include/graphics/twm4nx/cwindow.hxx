@@ -36,6 +36,7 @@
 
 #include <cstdint>
 #include <mqueue.h>
+#include <time.h>
 
 #include <nuttx/nx/nxglib.h>
 #include <nuttx/nx/nxterm.h>
@@ -174,6 +175,9 @@ namespace Twm4Nx
       struct nxgl_point_s         m_dragPos;     /**< Last reported mouse position */
       struct nxgl_size_s          m_dragCSize;   /**< The grab cursor size */
       bool                        m_dragging;    /**< True: Drag in-progress */
+#ifdef CONFIG_TWM4NX_OPAQUEMOVE
+      clock_t                     m_dragTime;    /**< Time of the last window movement */
+#endif
       volatile bool               m_clicked;     /**< True: Mouse left button is clicked */
 
       /**
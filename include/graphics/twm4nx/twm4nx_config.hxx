@@ -363,6 +363,25 @@
 #  define CONFIG_TWM4NX_ICONMGR_NCOLUMNS 4
 #endif
 
+// Events ////////////////////////////////////////////////////////////////////
+
+// CONFIG_TWM4NX_OPAQUEMOVE - Move dragged windows no more often than once
+//   per display refresh period.
+// CONFIG_TWM4NX_OPAQUEMOVE_PERIOD - The minimum time between two window
+//   moves in milliseconds.
+
+#if defined(CONFIG_TWM4NX_OPAQUEMOVE) && !defined(CONFIG_TWM4NX_OPAQUEMOVE_PERIOD)
+#  define CONFIG_TWM4NX_OPAQUEMOVE_PERIOD 16
+#endif
+
+// CONFIG_TWM4NX_EVENTBATCH - Receive all waiting events before dispatching
+//   them and drop superseded movement and redraw events.
+// CONFIG_TWM4NX_EVENTBATCH_SIZE - The maximum number of events in a batch.
+
+#if defined(CONFIG_TWM4NX_EVENTBATCH) && !defined(CONFIG_TWM4NX_EVENTBATCH_SIZE)
+#  define CONFIG_TWM4NX_EVENTBATCH_SIZE 8
+#endif
+
 // Cursor ////////////////////////////////////////////////////////////////////
 // Cursor Images
 
@@ -114,6 +114,15 @@ struct termcurses_ops_s
   /* Terminate  */
 
   CODE int (*terminate)(FAR struct termcurses_s *dev);
+
+  /* Write text at the current cursor position */
+
+  CODE int (*write)(FAR struct termcurses_s *dev, FAR const char *buffer,
+                    size_t buflen);
+
+  /* Send any buffered output to the terminal */
+
+  CODE int (*flush)(FAR struct termcurses_s *dev);
 };
 
 struct termcurses_dev_s
@@ -239,6 +248,28 @@ int termcurses_getkeycode(FAR struct termcurses_s *term, FAR int *specialkey,
 
 bool termcurses_checkkey(FAR struct termcurses_s *term);
 
+/****************************************************************************
+ * Name: termcurses_write
+ *
+ * Description:
+ *   Write text at the current cursor position.  The output may be held in
+ *   a buffer until termcurses_flush() is called.
+ *
+ ****************************************************************************/
+
+int termcurses_write(FAR struct termcurses_s *term, FAR const char *buffer,
+                     size_t buflen);
+
+/****************************************************************************
+ * Name: termcurses_flush
+ *
+ * Description:
+ *   Send any buffered output to the terminal.
+ *
+ ****************************************************************************/
+
+int termcurses_flush(FAR struct termcurses_s *term);
+
 #undef EXTERN
 #ifdef __cplusplus
 }
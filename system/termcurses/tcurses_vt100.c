@@ -54,6 +54,17 @@
 #define KEY_HOME        0x106  /* home key */
 #define KEY_F0          0x108  /* function keys; 64 reserved */
 
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+#  ifndef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF_SIZE
+#    define CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF_SIZE 256
+#  endif
+#endif
+
+/* Attributes that are set with SGR sequences */
+
+#define VT100_SGR_ATTRIBS  (TCURS_ATTRIB_BOLD | TCURS_ATTRIB_BLINK | \
+                            TCURS_ATTRIB_UNDERLINE)
+
 #ifdef CONFIG_TERMINFO_INCLUDE_NAME
 #define TINFO_ENTRY(n, d, c)  n, d, c
 #else
@@ -74,6 +85,23 @@ struct tcurses_vt100_s
   int    out_fd;
   int    keycount;
   char   keybuf[16];
+
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+  /* Terminal state as last sent.  -1 means unknown. */
+
+  int    row;                      /* Cursor row */
+  int    col;                      /* Cursor column */
+  int    ncols;                    /* Terminal width, 0 if unknown */
+  int    fgcolor;                  /* Foreground color index */
+  int    bgcolor;                  /* Background color index */
+  long   attrib;                   /* TCURS_ATTRIB_BOLD, _BLINK, _UNDERLINE */
+  int    cursor;                   /* 1: Cursor shown, 0: Cursor hidden */
+
+  /* Buffered output */
+
+  size_t outlen;
+  char   outbuf[CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF_SIZE];
+#endif
 };
 
 /************************************************************************************
@@ -94,6 +122,9 @@ static int tcurses_vt100_getkeycode(FAR struct termcurses_s *dev,
               FAR int *specialkey, FAR int *keymodifers);
 static bool tcurses_vt100_checkkey(FAR struct termcurses_s *dev);
 static int tcurses_vt100_terminate(FAR struct termcurses_s *dev);
+static int tcurses_vt100_write(FAR struct termcurses_s *dev,
+              FAR const char *buffer, size_t buflen);
+static int tcurses_vt100_flush(FAR struct termcurses_s *dev);
 
 /************************************************************************************
  * Private Data
@@ -109,7 +140,9 @@ static const struct termcurses_ops_s g_vt100_ops =
   tcurses_vt100_setattributes,
   tcurses_vt100_getkeycode,
   tcurses_vt100_checkkey,
-  tcurses_vt100_terminate
+  tcurses_vt100_terminate,
+  tcurses_vt100_write,
+  tcurses_vt100_flush
 };
 
 /* VT100 terminal codes */
@@ -119,17 +152,20 @@ static const char *g_clreos         = "\033[J";       /* Clear to end of screen
 static const char *g_clreol         = "\033[K";       /* Clear to end of line */
 
 static const char *g_movecurs       = "\033[%d;%dH";  /* Move cursor to x,y */
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+static const char *g_moverow        = "\033[%dH";     /* Move cursor to x,1 */
+#endif
 static const char *g_getwinsize     = "\x1b[s\x1b[999;999H\x1b[6n\x1bu";
-static const char *g_setfgcolor     = "\x1b[38;5;%dm";
-static const char *g_setbgcolor     = "\x1b[48;5;%dm";
+static const char *g_setfgcolor     = "38;5;%d";
+static const char *g_setbgcolor     = "48;5;%d";
 static const char *g_showcursor     = "\x1b[?25h";
 static const char *g_hidecursor     = "\x1b[?25l";
-static const char *g_setbold        = "\x1b[1";
-static const char *g_setnobold      = "\x1b[22";
-static const char *g_setblink       = ";5";
-static const char *g_setnoblink     = ";25";
-static const char *g_setunderline   = ";4";
-static const char *g_setnounderline = ";24";
+static const char *g_setbold        = "1";
+static const char *g_setnobold      = "22";
+static const char *g_setblink       = "5";
+static const char *g_setnoblink     = "25";
+static const char *g_setunderline   = "4";
+static const char *g_setnounderline = "24";
 
 /* Set default background and foreground colors. */
 
@@ -726,6 +762,212 @@ struct termcurses_dev_s g_vt100_tcurs =
  * Private Functions
  ************************************************************************************/
 
+/************************************************************************************
+ * Write all buffered output to the terminal
+ ************************************************************************************/
+
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+static int tcurses_vt100_flushbuf(FAR struct tcurses_vt100_s *priv)
+{
+  FAR const char *ptr = priv->outbuf;
+  size_t remaining    = priv->outlen;
+  ssize_t nwritten;
+
+  while (remaining > 0)
+    {
+      nwritten = write(priv->out_fd, ptr, remaining);
+      if (nwritten < 0)
+        {
+          if (errno == EINTR)
+            {
+              continue;
+            }
+
+          /* The buffered output is lost */
+
+          priv->outlen = 0;
+          return -errno;
+        }
+
+      ptr       += nwritten;
+      remaining -= nwritten;
+    }
+
+  priv->outlen = 0;
+  return OK;
+}
+#endif
+
+/************************************************************************************
+ * Send output to the terminal, or add it to the output buffer.  Returns the
+ * number of bytes accepted or a negated errno value.
+ ************************************************************************************/
+
+static int tcurses_vt100_output(FAR struct tcurses_vt100_s *priv,
+                                FAR const char *buffer, size_t buflen)
+{
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+  int ret;
+
+  /* Make room in the buffer if necessary */
+
+  if (priv->outlen + buflen > CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF_SIZE)
+    {
+      ret = tcurses_vt100_flushbuf(priv);
+      if (ret < 0)
+        {
+          return ret;
+        }
+
+      /* Output larger than the buffer is sent directly */
+
+      if (buflen > CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF_SIZE)
+        {
+          return write(priv->out_fd, buffer, buflen);
+        }
+    }
+
+  memcpy(&priv->outbuf[priv->outlen], buffer, buflen);
+  priv->outlen += buflen;
+  return buflen;
+#else
+  return write(priv->out_fd, buffer, buflen);
+#endif
+}
+
+/************************************************************************************
+ * Append one parameter to an SGR sequence being built in str
+ ************************************************************************************/
+
+static void tcurses_vt100_addparam(FAR char *str, size_t size,
+                                   FAR const char *param)
+{
+  /* Parameters after the "\x1b[" introducer are separated by ';' */
+
+  if (strlen(str) > 2)
+    {
+      strlcat(str, ";", size);
+    }
+
+  strlcat(str, param, size);
+}
+
+/************************************************************************************
+ * Build a relative cursor move of n steps in the direction given by the final
+ * character of the sequence (A=up, B=down, C=right, D=left).
+ ************************************************************************************/
+
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+static int tcurses_vt100_step(FAR char *str, size_t size, int n, char dir)
+{
+  if (n == 1)
+    {
+      /* Left by one is a single backspace.  The count may be omitted for
+       * the other directions.
+       */
+
+      if (dir == 'D')
+        {
+          return snprintf(str, size, "\b");
+        }
+
+      return snprintf(str, size, "\033[%c", dir);
+    }
+
+  return snprintf(str, size, "\033[%d%c", n, dir);
+}
+
+/************************************************************************************
+ * Build the shortest sequence that moves the cursor to row, col.  Relative moves
+ * are only considered if the current position is known.
+ ************************************************************************************/
+
+static int tcurses_vt100_movestr(FAR struct tcurses_vt100_s *priv,
+                                 FAR char *str, size_t size, int row, int col)
+{
+  char rel[32];
+  char horiz[16];
+  char cr[16];
+  int  len;
+  int  rlen;
+  int  hlen;
+  int  crlen;
+
+  /* An absolute move always works */
+
+  if (col == 0)
+    {
+      len = snprintf(str, size, g_moverow, row + 1);
+    }
+  else
+    {
+      len = snprintf(str, size, g_movecurs, row + 1, col + 1);
+    }
+
+  if (priv->row < 0 || priv->col < 0)
+    {
+      return len;
+    }
+
+  /* Vertical part of a relative move */
+
+  rel[0] = '\0';
+  rlen = 0;
+  if (row < priv->row)
+    {
+      rlen = tcurses_vt100_step(rel, sizeof(rel), priv->row - row, 'A');
+    }
+  else if (row > priv->row)
+    {
+      rlen = tcurses_vt100_step(rel, sizeof(rel), row - priv->row, 'B');
+    }
+
+  /* Horizontal part.  Moving left may also be done with a carriage return
+   * followed by a move right from column 0.
+   */
+
+  if (col < priv->col)
+    {
+      hlen = tcurses_vt100_step(horiz, sizeof(horiz), priv->col - col, 'D');
+
+      cr[0] = '\r';
+      cr[1] = '\0';
+      crlen = 1;
+      if (col > 0)
+        {
+          crlen += tcurses_vt100_step(&cr[1], sizeof(cr) - 1, col, 'C');
+        }
+
+      if (crlen < hlen)
+        {
+          strlcpy(horiz, cr, sizeof(horiz));
+          hlen = crlen;
+        }
+    }
+  else if (col > priv->col)
+    {
+      hlen = tcurses_vt100_step(horiz, sizeof(horiz), col - priv->col, 'C');
+    }
+  else
+    {
+      horiz[0] = '\0';
+      hlen = 0;
+    }
+
+  rlen += hlen;
+
+  /* Use the relative move if it is shorter */
+
+  if (rlen < len)
+    {
+      snprintf(str, size, "%s%s", rel, horiz);
+      len = rlen;
+    }
+
+  return len;
+}
+#endif
+
 /************************************************************************************
  * Clear screen / line operations
  ************************************************************************************/
@@ -734,28 +976,26 @@ static int tcurses_vt100_clear(FAR struct termcurses_s *dev, int type)
 {
   FAR struct tcurses_vt100_s *priv;
   int ret = -ENOSYS;
-  int fd;
 
   priv = (FAR struct tcurses_vt100_s *)dev;
-  fd = priv->out_fd;
 
   /* Perform operation based on type */
 
   switch (type)
     {
       case TCURS_CLEAR_SCREEN:
-        ret = write(fd, g_clrscr, strlen(g_clrscr));
+        ret = tcurses_vt100_output(priv, g_clrscr, strlen(g_clrscr));
         break;
 
       case TCURS_CLEAR_LINE:
         break;
 
       case TCURS_CLEAR_EOS:
-        ret = write(fd, g_clrscr, strlen(g_clreos));
+        ret = tcurses_vt100_output(priv, g_clreos, strlen(g_clreos));
         break;
 
       case TCURS_CLEAR_EOL:
-        ret = write(fd, g_clrscr, strlen(g_clreol));
+        ret = tcurses_vt100_output(priv, g_clreol, strlen(g_clreol));
         break;
 
       default:
@@ -781,19 +1021,30 @@ static int tcurses_vt100_move(FAR struct termcurses_s *dev, int type,
 {
   FAR struct tcurses_vt100_s *priv;
   int   ret = -ENOSYS;
-  int   fd;
-  char  str[32];
+  char  str[48];
 
   priv = (FAR struct tcurses_vt100_s *)dev;
-  fd   = priv->out_fd;
 
   /* Perform operation based on type */
 
   switch (type)
     {
       case TCURS_MOVE_YX:
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+        /* Nothing to send if the cursor is already there */
+
+        if (row == priv->row && col == priv->col)
+          {
+            return OK;
+          }
+
+        tcurses_vt100_movestr(priv, str, sizeof(str), row, col);
+        priv->row = row;
+        priv->col = col;
+#else
         snprintf(str, sizeof(str), g_movecurs, row + 1, col + 1);
-        ret = write(fd, str, strlen(str));
+#endif
+        ret = tcurses_vt100_output(priv, str, strlen(str));
         break;
 
       default:
@@ -905,20 +1156,19 @@ static int tcurses_vt100_setcolors(FAR struct termcurses_s *dev,
 {
   FAR struct tcurses_vt100_s *priv;
   int  ret = -ENOSYS;
-  int  fd;
+  int  fgcolor = -1;
+  int  bgcolor = -1;
+  char param[16];
   char str[48];
 
   priv = (FAR struct tcurses_vt100_s *)dev;
-  fd   = priv->out_fd;
 
   /* Test if FG color to be set */
 
   if ((colors->color_mask & TCURS_COLOR_FG) != 0)
     {
-      sprintf(str, g_setfgcolor,
-              tcurses_vt100_getcolorindex(colors->fg_red, colors->fg_green,
-                                          colors->fg_blue));
-      ret = write(fd, str, strlen(str));
+      fgcolor = tcurses_vt100_getcolorindex(colors->fg_red, colors->fg_green,
+                                            colors->fg_blue);
     }
 
   /* Test if BG color to be set */
@@ -930,10 +1180,57 @@ static int tcurses_vt100_setcolors(FAR struct termcurses_s *dev,
           colors->bg_red = 0;
         }
 
-      sprintf(str, g_setbgcolor,
-              tcurses_vt100_getcolorindex(colors->bg_red, colors->bg_green,
-                                          colors->bg_blue));
-      ret = write(fd, str, strlen(str));
+      bgcolor = tcurses_vt100_getcolorindex(colors->bg_red, colors->bg_green,
+                                            colors->bg_blue);
+    }
+
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+  /* Don't send colors that are already selected */
+
+  if (fgcolor == priv->fgcolor)
+    {
+      fgcolor = -1;
+    }
+  else if (fgcolor >= 0)
+    {
+      priv->fgcolor = fgcolor;
+    }
+
+  if (bgcolor == priv->bgcolor)
+    {
+      bgcolor = -1;
+    }
+  else if (bgcolor >= 0)
+    {
+      priv->bgcolor = bgcolor;
+    }
+
+  if (fgcolor < 0 && bgcolor < 0)
+    {
+      return OK;
+    }
+#endif
+
+  /* Set both colors with one sequence */
+
+  strlcpy(str, "\x1b[", sizeof(str));
+
+  if (fgcolor >= 0)
+    {
+      snprintf(param, sizeof(param), g_setfgcolor, fgcolor);
+      tcurses_vt100_addparam(str, sizeof(str), param);
+    }
+
+  if (bgcolor >= 0)
+    {
+      snprintf(param, sizeof(param), g_setbgcolor, bgcolor);
+      tcurses_vt100_addparam(str, sizeof(str), param);
+    }
+
+  if (fgcolor >= 0 || bgcolor >= 0)
+    {
+      strlcat(str, "m", sizeof(str));
+      ret = tcurses_vt100_output(priv, str, strlen(str));
     }
 
   /* If bytes written, return OK */
@@ -969,9 +1266,22 @@ static int tcurses_vt100_getwinsize(FAR struct termcurses_s *dev,
   ret = ioctl(fd, TIOCGWINSZ, (unsigned long) winsz);
   if (ret == OK)
     {
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+      priv->ncols = winsz->ws_col;
+#endif
       return OK;
     }
 
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+  /* Send any buffered output before the query.  The query moves the
+   * cursor.
+   */
+
+  tcurses_vt100_flushbuf(priv);
+  priv->row = -1;
+  priv->col = -1;
+#endif
+
   /* Write command to get window size */
 
   ret = write(fd, g_getwinsize, strlen(g_getwinsize));
@@ -1024,6 +1334,9 @@ static int tcurses_vt100_getwinsize(FAR struct termcurses_s *dev,
               if (ch == ';')
                 {
                   winsz->ws_col = atoi(&resp[x + 1]);
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+                  priv->ncols   = winsz->ws_col;
+#endif
                 }
 
               /* Change back to original block/non-block mode */
@@ -1051,63 +1364,94 @@ static int tcurses_vt100_setattributes(FAR struct termcurses_s *dev,
                                        unsigned long attrib)
 {
   FAR struct tcurses_vt100_s *priv;
+  unsigned long changed;
   int ret;
-  int fd;
   char str[48];
 
   priv = (FAR struct tcurses_vt100_s *)dev;
-  fd   = priv->out_fd;
 
   /* Test for cursor hide */
 
   if (attrib & TCURS_ATTRIB_CURS_HIDE)
     {
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+      if (priv->cursor == 0)
+        {
+          return OK;
+        }
+
+      priv->cursor = 0;
+#endif
+
       /* Send sequence to hide the cursor */
 
-      ret = write(fd, g_hidecursor, strlen(g_hidecursor));
+      ret = tcurses_vt100_output(priv, g_hidecursor, strlen(g_hidecursor));
       return ret;
     }
 
   if (attrib & TCURS_ATTRIB_CURS_SHOW)
     {
-      /* Send sequence to hide the cursor */
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+      if (priv->cursor == 1)
+        {
+          return OK;
+        }
+
+      priv->cursor = 1;
+#endif
+
+      /* Send sequence to show the cursor */
 
-      ret = write(fd, g_showcursor, strlen(g_showcursor));
+      ret = tcurses_vt100_output(priv, g_showcursor, strlen(g_showcursor));
       return ret;
     }
 
-  /* Build attribute string */
+  /* Select the attributes to be sent */
 
-  if (attrib & TCURS_ATTRIB_BOLD)
-    {
-      strlcpy(str, g_setbold, sizeof(str));
-    }
-  else
-    {
-      strlcpy(str, g_setnobold, sizeof(str));
-    }
+  changed = VT100_SGR_ATTRIBS;
+
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+  /* Only send the attributes that differ from the current ones */
 
-  if (attrib & TCURS_ATTRIB_BLINK)
+  attrib &= VT100_SGR_ATTRIBS;
+  if (priv->attrib >= 0)
     {
-      strcat(str, g_setblink);
+      changed = attrib ^ (unsigned long)priv->attrib;
+      if (changed == 0)
+        {
+          return OK;
+        }
     }
-  else
+
+  priv->attrib = attrib;
+#endif
+
+  /* Build attribute string */
+
+  strlcpy(str, "\x1b[", sizeof(str));
+
+  if (changed & TCURS_ATTRIB_BOLD)
     {
-      strcat(str, g_setnoblink);
+      tcurses_vt100_addparam(str, sizeof(str), (attrib & TCURS_ATTRIB_BOLD) ?
+                             g_setbold : g_setnobold);
     }
 
-  if (attrib & TCURS_ATTRIB_UNDERLINE)
+  if (changed & TCURS_ATTRIB_BLINK)
     {
-      strcat(str, g_setunderline);
+      tcurses_vt100_addparam(str, sizeof(str), (attrib & TCURS_ATTRIB_BLINK) ?
+                             g_setblink : g_setnoblink);
     }
-  else
+
+  if (changed & TCURS_ATTRIB_UNDERLINE)
     {
-      strcat(str, g_setnounderline);
+      tcurses_vt100_addparam(str, sizeof(str),
+                             (attrib & TCURS_ATTRIB_UNDERLINE) ?
+                             g_setunderline : g_setnounderline);
     }
 
-  strcat(str, "m");
+  strlcat(str, "m", sizeof(str));
 
-  ret = write(fd, str, strlen(str));
+  ret = tcurses_vt100_output(priv, str, strlen(str));
 
   /* If bytes written, return OK */
 
@@ -1483,6 +1827,19 @@ FAR struct termcurses_s *tcurses_vt100_initialize(int in_fd, int out_fd)
   priv->out_fd   = out_fd;
   priv->keycount = 0;
 
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+  /* Nothing is known about the terminal state yet */
+
+  priv->row      = -1;
+  priv->col      = -1;
+  priv->ncols    = 0;
+  priv->fgcolor  = -1;
+  priv->bgcolor  = -1;
+  priv->attrib   = -1;
+  priv->cursor   = -1;
+  priv->outlen   = 0;
+#endif
+
   return (FAR struct termcurses_s *)priv;
 }
 
@@ -1497,16 +1854,89 @@ FAR struct termcurses_s *tcurses_vt100_initialize(int in_fd, int out_fd)
 static int tcurses_vt100_terminate(FAR struct termcurses_s *dev)
 {
   FAR struct tcurses_vt100_s *priv;
-  int  fd;
 
   priv = (FAR struct tcurses_vt100_s *)dev;
-  fd   = priv->out_fd;
 
   /* Set default foreground and background colors.
    * (Ignore the return result.)
    */
 
-  write(fd, g_setdefcolors, strlen(g_setdefcolors));
+  tcurses_vt100_output(priv, g_setdefcolors, strlen(g_setdefcolors));
+  tcurses_vt100_flush(dev);
 
   return OK;
 }
+
+/************************************************************************************
+ * Name: tcurses_vt100_write
+ *
+ * Description:
+ *   Write text at the current cursor position.
+ *
+ ************************************************************************************/
+
+static int tcurses_vt100_write(FAR struct termcurses_s *dev,
+                               FAR const char *buffer, size_t buflen)
+{
+  FAR struct tcurses_vt100_s *priv;
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+  size_t i;
+#endif
+
+  priv = (FAR struct tcurses_vt100_s *)dev;
+
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+  /* Follow the cursor as the text is output */
+
+  for (i = 0; i < buflen && priv->col >= 0; i++)
+    {
+      /* Character set selection does not move the cursor */
+
+      if (buffer[i] == '\x1b' && i + 2 < buflen &&
+          (buffer[i + 1] == '(' || buffer[i + 1] == ')'))
+        {
+          i += 2;
+          continue;
+        }
+
+      /* Don't try to follow any other control characters */
+
+      if ((uint8_t)buffer[i] < 0x20 || (uint8_t)buffer[i] >= 0x7f)
+        {
+          priv->col = -1;
+          break;
+        }
+
+      priv->col++;
+    }
+
+  /* After writing the last column, the terminal may or may not have wrapped
+   * to the next line.
+   */
+
+  if (priv->col < 0 || priv->ncols <= 0 || priv->col >= priv->ncols)
+    {
+      priv->row = -1;
+      priv->col = -1;
+    }
+#endif
+
+  return tcurses_vt100_output(priv, buffer, buflen);
+}
+
+/************************************************************************************
+ * Name: tcurses_vt100_flush
+ *
+ * Description:
+ *   Send any buffered output to the terminal.
+ *
+ ************************************************************************************/
+
+static int tcurses_vt100_flush(FAR struct termcurses_s *dev)
+{
+#ifdef CONFIG_SYSTEM_TERMCURSES_VT100_OUTBUF
+  return tcurses_vt100_flushbuf((FAR struct tcurses_vt100_s *)dev);
+#else
+  return OK;
+#endif
+}
@@ -277,3 +277,51 @@ bool termcurses_checkkey(FAR struct termcurses_s *term)
 
   return 0;
 }
+
+/************************************************************************************
+ * Name: termcurses_write
+ *
+ * Description:
+ *   Write text at the current cursor position.  The output may be held in
+ *   a buffer until termcurses_flush() is called.
+ *
+ ************************************************************************************/
+
+int termcurses_write(FAR struct termcurses_s *term, FAR const char *buffer,
+                     size_t buflen)
+{
+  FAR struct termcurses_dev_s *dev = (FAR struct termcurses_dev_s *)term;
+
+  /* Call the dev function */
+
+  if (dev->ops->write)
+    {
+      return dev->ops->write(term, buffer, buflen);
+    }
+
+  return -ENOSYS;
+}
+
+/************************************************************************************
+ * Name: termcurses_flush
+ *
+ * Description:
+ *   Send any buffered output to the terminal.
+ *
+ ************************************************************************************/
+
+int termcurses_flush(FAR struct termcurses_s *term)
+{
+  FAR struct termcurses_dev_s *dev = (FAR struct termcurses_dev_s *)term;
+
+  /* Call the dev function.  There is nothing to do if the device does not
+   * buffer its output.
+   */
+
+  if (dev->ops->flush)
+    {
+      return dev->ops->flush(term);
+    }
+
+  return OK;
+}